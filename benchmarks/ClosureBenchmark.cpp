@@ -0,0 +1,193 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/HOF.h"
+#include "yafl/Maybe.h"
+#include "yafl/Either.h"
+#include <string>
+#include <benchmark/benchmark.h>
+
+/**
+ * std::function based implementations of curry, partial and lift, as they were before the
+ * combinators returned concrete closure types. Kept only as a baseline for comparison.
+ */
+namespace legacy {
+
+template <typename Callable>
+decltype(auto) curry(Callable&& callable) {
+    if constexpr (std::is_invocable_v<std::decay_t<Callable>>) {
+        return callable();
+    } else {
+        using FirstArg = typename yafl::function::Info<Callable>::template ArgType<0>;
+        return [callable = std::forward<Callable>(callable)](const FirstArg& arg) {
+            using ReturnFunType = typename yafl::function::Info<Callable>::PartialApplyFirst;
+
+            const ReturnFunType inner_func = [callable, arg = std::move(arg)](auto&& ...args) {
+                return callable(std::move(arg), std::forward<decltype(args)>(args)...);
+            };
+
+            return curry(std::move(inner_func));
+        };
+    }
+}
+
+template <typename Callable, typename ...Args>
+decltype(auto) partial(Callable&& callable, Args&& ...args) {
+    using IsTupleSubset = yafl::tuple::IsTupleSubset<typename yafl::function::Info<Callable>::ArgTypes, std::tuple<Args...>>;
+    using RemainingArgsTuple = yafl::tuple::TupleSubset<IsTupleSubset::index, typename yafl::function::Info<Callable>::ArgTypes>;
+    using ReturnType = yafl::function::FunctionFromTuple<typename yafl::function::Info<Callable>::ReturnType, RemainingArgsTuple>;
+
+    const ReturnType f = [callable = std::forward<Callable>(callable), vargs = std::make_tuple(std::forward<Args>(args)...)](auto&& ...inner_args) {
+        return std::apply([callable = std::move(callable)](auto&& ...apply_args){
+                              return callable(std::forward<decltype(apply_args)>(apply_args)...);
+                          },
+                          std::tuple_cat(vargs, std::make_tuple(inner_args...)));
+    };
+
+    return f;
+}
+
+template<typename Callable>
+decltype(auto) maybe_lift(Callable&& callable) {
+    using ReturnType = typename yafl::function::Info<Callable>::ReturnType;
+    using ReturnFunctionType = typename yafl::function::Info<Callable>::template LiftedSignature<yafl::Maybe>;
+
+    const ReturnFunctionType function = [callable = std::forward<Callable>(callable)](auto&& ...args) -> yafl::Maybe<ReturnType> {
+        if (yafl::all([](auto &&v) { return v.hasValue(); }, args...)) {
+            const auto tp = yafl::tuple::map_append([](auto&& arg) { return arg.value(); }, std::make_tuple(), args...);
+            return yafl::Maybe<ReturnType>::Just(std::apply(callable, tp));
+        } else {
+            return yafl::Maybe<ReturnType>::Nothing();
+        }
+    };
+
+    return function;
+}
+
+template<typename ErrorType, typename Head>
+ErrorType getFailedValue(const Head& head) {
+    return head.error();
+}
+
+template<typename ErrorType, typename Head, typename ...Tail>
+ErrorType getFailedValue(const Head& head, Tail&& ...tail) {
+    if (head.isError()) {
+        return head.error();
+    } else {
+        return getFailedValue<ErrorType>(std::forward<Tail>(tail)...);
+    }
+}
+
+template<typename ErrorType, typename Callable>
+decltype(auto) either_lift(Callable&& callable) {
+    using ReturnType = typename yafl::function::Info<Callable>::ReturnType;
+    using PinErrorType = typename yafl::type::PinErrorType<ErrorType>;
+    using ReturnFunctionType = typename yafl::function::Info<Callable>::template LiftedSignature<PinErrorType::template Type>;
+
+    const ReturnFunctionType function = [callable = std::forward<Callable>(callable)](auto&& ...args) -> yafl::Either<ErrorType, ReturnType> {
+        if (yafl::all([](const auto &v) { return v.isOk(); }, args...)) {
+            const auto tp = yafl::tuple::map_append([](auto&& arg){ return arg.value();}, std::make_tuple(), args...);
+            return yafl::Either<ErrorType, ReturnType>::Ok(std::apply(callable, tp));
+        } else {
+            return yafl::Either<ErrorType, ReturnType>::Error(getFailedValue<ErrorType>(args...));
+        }
+    };
+
+    return function;
+}
+
+} // namespace legacy
+
+namespace {
+
+const auto add3 = [](int a, int b, int c) { return a + b + c; };
+
+void BM_Curry_StdFunction(benchmark::State& state) {
+    const auto curried = legacy::curry(add3);
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(curried(i)(2)(3));
+        ++i;
+    }
+}
+BENCHMARK(BM_Curry_StdFunction);
+
+void BM_Curry_Closure(benchmark::State& state) {
+    const auto curried = yafl::curry(add3);
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(curried(i)(2)(3));
+        ++i;
+    }
+}
+BENCHMARK(BM_Curry_Closure);
+
+void BM_Partial_StdFunction(benchmark::State& state) {
+    const auto partial = legacy::partial(add3, 1, 2);
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(partial(i));
+        ++i;
+    }
+}
+BENCHMARK(BM_Partial_StdFunction);
+
+void BM_Partial_Closure(benchmark::State& state) {
+    const auto partial = yafl::partial(add3, 1, 2);
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(partial(i));
+        ++i;
+    }
+}
+BENCHMARK(BM_Partial_Closure);
+
+void BM_MaybeLift_StdFunction(benchmark::State& state) {
+    const auto lifted = legacy::maybe_lift(add3);
+    const auto a = yafl::maybe::Just(1);
+    const auto b = yafl::maybe::Just(2);
+    const auto c = yafl::maybe::Just(3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lifted(a, b, c));
+    }
+}
+BENCHMARK(BM_MaybeLift_StdFunction);
+
+void BM_MaybeLift_Closure(benchmark::State& state) {
+    const auto lifted = yafl::maybe::lift(add3);
+    const auto a = yafl::maybe::Just(1);
+    const auto b = yafl::maybe::Just(2);
+    const auto c = yafl::maybe::Just(3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lifted(a, b, c));
+    }
+}
+BENCHMARK(BM_MaybeLift_Closure);
+
+void BM_EitherLift_StdFunction(benchmark::State& state) {
+    const auto lifted = legacy::either_lift<std::string>(add3);
+    const auto a = yafl::Either<std::string, int>::Ok(1);
+    const auto b = yafl::Either<std::string, int>::Ok(2);
+    const auto c = yafl::Either<std::string, int>::Ok(3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lifted(a, b, c));
+    }
+}
+BENCHMARK(BM_EitherLift_StdFunction);
+
+void BM_EitherLift_Closure(benchmark::State& state) {
+    const auto lifted = yafl::either::lift<std::string>(add3);
+    const auto a = yafl::Either<std::string, int>::Ok(1);
+    const auto b = yafl::Either<std::string, int>::Ok(2);
+    const auto c = yafl::Either<std::string, int>::Ok(3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lifted(a, b, c));
+    }
+}
+BENCHMARK(BM_EitherLift_Closure);
+
+} // namespace
@@ -0,0 +1,131 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Coroutine.h"
+#include "yafl/Either.h"
+#include "yafl/Maybe.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+using namespace yafl;
+
+namespace {
+
+using Result = Either<std::string, int>;
+
+/// Inputs where roughly one in eight fails at one of the three steps
+std::vector<int> inputs() {
+    std::vector<int> values(1024);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i * 2654435761U % 1000U) - 60;
+    }
+    return values;
+}
+
+[[gnu::noinline]] Maybe<int> checkPositive(int value) {
+    return value > 0 ? Maybe<int>::Just(value) : Maybe<int>::Nothing();
+}
+
+[[gnu::noinline]] Result halve(int value) {
+    return value % 2 == 0 ? Result::Ok(value / 2) : Result::Ok((value - 1) / 2);
+}
+
+[[gnu::noinline]] Result checkedDivide(int dividend, int divisor) {
+    return divisor == 0 ? Result::Error("division by zero") : Result::Ok(dividend / divisor);
+}
+
+Result toEither(const Maybe<int>& value) {
+    return value.hasValue() ? Result::Ok(*value) : Result::Error("not positive");
+}
+
+Result pipelineBind(int value) {
+    return toEither(checkPositive(value))
+            .bind([](int positive) { return halve(positive); })
+            .bind([](int half) {
+                return checkedDivide(1000, half % 7)
+                        .fmap([half](int quotient) { return quotient + half; });
+            });
+}
+
+Result pipelineEarlyReturn(int value) {
+    auto positive = checkPositive(value);
+    if (!positive.hasValue()) {
+        return Result::Error("not positive");
+    }
+    auto half = halve(*positive);
+    if (!half.isOk()) {
+        return half;
+    }
+    auto quotient = checkedDivide(1000, *half % 7);
+    if (!quotient.isOk()) {
+        return quotient;
+    }
+    return Result::Ok(*quotient + *half);
+}
+
+Result pipelineCoroutine(int value) {
+    auto positive = co_await toEither(checkPositive(value));
+    auto half = co_await halve(positive);
+    auto quotient = co_await checkedDivide(1000, half % 7);
+    co_return quotient + half;
+}
+
+template <Result (*Pipeline)(int)>
+void BM_Pipeline(benchmark::State& state) {
+    const auto values = inputs();
+    for (auto _ : state) {
+        for (int value : values) {
+            benchmark::DoNotOptimize(Pipeline(value));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK_TEMPLATE(BM_Pipeline, pipelineEarlyReturn)->Name("BM_CoroutinePipeline_EarlyReturn");
+BENCHMARK_TEMPLATE(BM_Pipeline, pipelineBind)->Name("BM_CoroutinePipeline_Bind");
+BENCHMARK_TEMPLATE(BM_Pipeline, pipelineCoroutine)->Name("BM_CoroutinePipeline_Coroutine");
+
+Maybe<int> maybeBind(int value) {
+    return checkPositive(value)
+            .bind([](int positive) { return checkPositive(positive - 100); })
+            .bind([](int shifted) { return checkPositive(shifted - 100); });
+}
+
+Maybe<int> maybeEarlyReturn(int value) {
+    auto positive = checkPositive(value);
+    if (!positive.hasValue()) {
+        return positive;
+    }
+    auto shifted = checkPositive(*positive - 100);
+    if (!shifted.hasValue()) {
+        return shifted;
+    }
+    return checkPositive(*shifted - 100);
+}
+
+Maybe<int> maybeCoroutine(int value) {
+    auto positive = co_await checkPositive(value);
+    auto shifted = co_await checkPositive(positive - 100);
+    co_return co_await checkPositive(shifted - 100);
+}
+
+template <Maybe<int> (*Pipeline)(int)>
+void BM_MaybePipeline(benchmark::State& state) {
+    const auto values = inputs();
+    for (auto _ : state) {
+        for (int value : values) {
+            benchmark::DoNotOptimize(Pipeline(value));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK_TEMPLATE(BM_MaybePipeline, maybeEarlyReturn)->Name("BM_CoroutineMaybe_EarlyReturn");
+BENCHMARK_TEMPLATE(BM_MaybePipeline, maybeBind)->Name("BM_CoroutineMaybe_Bind");
+BENCHMARK_TEMPLATE(BM_MaybePipeline, maybeCoroutine)->Name("BM_CoroutineMaybe_Coroutine");
+
+} // namespace
@@ -0,0 +1,88 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "Payloads.h"
+#include "yafl/HOF.h"
+#include "yafl/Either.h"
+#include <variant>
+#include <benchmark/benchmark.h>
+
+using namespace bench;
+
+namespace {
+
+/// Hand-written error handling: error code or value
+template<typename T>
+using Result = std::variant<int, T>;
+
+template<typename T>
+void BM_EitherFmap_Baseline(benchmark::State& state) {
+    const Result<T> result{std::in_place_index<1>, makePayload<T>()};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(result.index() == 1 ? Result<T>{std::in_place_index<1>, mutate(std::get<1>(result))}
+                                                     : Result<T>{std::in_place_index<0>, std::get<0>(result)});
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_EitherFmap_Baseline);
+
+template<typename T>
+void BM_EitherFmap_Yafl(benchmark::State& state) {
+    const auto either = yafl::Either<int, T>::Ok(makePayload<T>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(either.fmap([](T v) { return mutate(std::move(v)); }));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_EitherFmap_Yafl);
+
+template<typename T>
+void BM_EitherBind_Baseline(benchmark::State& state) {
+    const auto f = [](T v) { return Result<T>{std::in_place_index<1>, mutate(std::move(v))}; };
+    const Result<T> result{std::in_place_index<1>, makePayload<T>()};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(result.index() == 1 ? f(std::get<1>(result))
+                                                     : Result<T>{std::in_place_index<0>, std::get<0>(result)});
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_EitherBind_Baseline);
+
+template<typename T>
+void BM_EitherBind_Yafl(benchmark::State& state) {
+    const auto f = [](T v) { return yafl::Either<int, T>::Ok(mutate(std::move(v))); };
+    const auto either = yafl::Either<int, T>::Ok(makePayload<T>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(either.bind(f));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_EitherBind_Yafl);
+
+template<typename T>
+void BM_EitherLift_Baseline(benchmark::State& state) {
+    const auto f = [](T v, int i) { return combine(std::move(v), i); };
+    const Result<T> lhs{std::in_place_index<1>, makePayload<T>()};
+    const Result<int> rhs{std::in_place_index<1>, 1};
+    for (auto _ : state) {
+        if (lhs.index() == 1 && rhs.index() == 1) {
+            benchmark::DoNotOptimize(Result<T>{std::in_place_index<1>, f(std::get<1>(lhs), std::get<1>(rhs))});
+        } else {
+            benchmark::DoNotOptimize(Result<T>{std::in_place_index<0>, lhs.index() == 0 ? std::get<0>(lhs) : std::get<0>(rhs)});
+        }
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_EitherLift_Baseline);
+
+template<typename T>
+void BM_EitherLift_Yafl(benchmark::State& state) {
+    const auto lifted = yafl::either::lift<int>([](T v, int i) { return combine(std::move(v), i); });
+    const auto lhs = yafl::Either<int, T>::Ok(makePayload<T>());
+    const auto rhs = yafl::Either<int, int>::Ok(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lifted(lhs, rhs));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_EitherLift_Yafl);
+
+} // namespace
@@ -0,0 +1,108 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Either.h"
+#include "yafl/EitherVector.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+constexpr std::size_t RowCount = 1 << 12;
+
+enum class ErrorCode { Missing, Invalid };
+
+struct Row {
+    std::int64_t id;
+    double amount;
+    std::int32_t quantity;
+};
+
+Row makeRow(std::size_t i) {
+    return Row{static_cast<std::int64_t>(i), static_cast<double>(i) * 0.5, static_cast<std::int32_t>(i % 100)};
+}
+
+/// One error every errorEvery rows
+std::vector<yafl::Either<ErrorCode, Row>> makeRows(std::size_t errorEvery) {
+    std::vector<yafl::Either<ErrorCode, Row>> rows;
+    rows.reserve(RowCount);
+    for (std::size_t i = 0; i < RowCount; ++i) {
+        rows.push_back(i % errorEvery == 0 ? yafl::Either<ErrorCode, Row>::Error(ErrorCode::Invalid)
+                                           : yafl::Either<ErrorCode, Row>::Ok(makeRow(i)));
+    }
+    return rows;
+}
+
+yafl::EitherVector<ErrorCode, Row> makeColumn(std::size_t errorEvery) {
+    yafl::EitherVector<ErrorCode, Row> column;
+    column.reserve(RowCount);
+    for (const auto& row : makeRows(errorEvery)) {
+        column.push_back(row);
+    }
+    return column;
+}
+
+const auto total = [](const Row& row) {
+    return row.amount * row.quantity;
+};
+
+void BM_ResultsFmap_VectorOfEither(benchmark::State& state) {
+    const auto rows = makeRows(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<yafl::Either<ErrorCode, double>> result;
+        result.reserve(rows.size());
+        for (const auto& row : rows) {
+            result.push_back(row.fmap(total));
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.counters["bytes_per_row"] = static_cast<double>(sizeof(yafl::Either<ErrorCode, Row>));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RowCount));
+}
+BENCHMARK(BM_ResultsFmap_VectorOfEither)->Arg(100)->Arg(1000);
+
+void BM_ResultsFmap_EitherVector(benchmark::State& state) {
+    const auto column = makeColumn(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(column.fmap(total));
+    }
+    const double errorBytes = static_cast<double>(column.errorCount() * (sizeof(std::size_t) + sizeof(ErrorCode)));
+    state.counters["bytes_per_row"] = sizeof(Row) + 1.0 / 8 + errorBytes / RowCount;
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(RowCount));
+}
+BENCHMARK(BM_ResultsFmap_EitherVector)->Arg(100)->Arg(1000);
+
+void BM_ResultsPartition_VectorOfEither(benchmark::State& state) {
+    const auto rows = makeRows(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<ErrorCode> errors;
+        std::vector<Row> values;
+        values.reserve(rows.size());
+        for (const auto& row : rows) {
+            if (row.isOk()) {
+                values.push_back(row.value_ref());
+            } else {
+                errors.push_back(row.error_ref());
+            }
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(errors.data());
+    }
+}
+BENCHMARK(BM_ResultsPartition_VectorOfEither)->Arg(100);
+
+void BM_ResultsPartition_EitherVector(benchmark::State& state) {
+    const auto column = makeColumn(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(column.partition());
+    }
+}
+BENCHMARK(BM_ResultsPartition_EitherVector)->Arg(100);
+
+} // namespace
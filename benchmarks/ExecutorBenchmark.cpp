@@ -0,0 +1,111 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/WorkStealingExecutor.h"
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+constexpr int ForkJoinTasks = 256;
+
+/// Some work per task, so that tasks are not only scheduling overhead
+unsigned work(unsigned seed, int rounds) {
+    for (int i = 0; i < rounds; ++i) {
+        seed = seed * 31U + 7U;
+    }
+    return seed;
+}
+
+void waitFor(const std::atomic<int>& pending) {
+    while (pending.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+}
+
+/// Splits [begin, end) in halves, spawning one half as a new task, until a single task is left
+void forkJoin(yafl::executor::Executor& pool, std::atomic<int>& pending, int begin, int end, int rounds) {
+    while (end - begin > 1) {
+        const int middle = begin + (end - begin) / 2;
+        pool.execute([&pool, &pending, middle, end, rounds]() { forkJoin(pool, pending, middle, end, rounds); });
+        end = middle;
+    }
+    benchmark::DoNotOptimize(work(static_cast<unsigned>(begin), rounds));
+    pending.fetch_sub(1, std::memory_order_release);
+}
+
+void BM_SpawnLatency_StdAsync(benchmark::State& state) {
+    for (auto _ : state) {
+        std::async(std::launch::async, []() {}).wait();
+    }
+}
+BENCHMARK(BM_SpawnLatency_StdAsync)->UseRealTime();
+
+void BM_SpawnLatency_WorkStealing(benchmark::State& state) {
+    yafl::executor::WorkStealingExecutor pool;
+    std::atomic<int> pending{0};
+    for (auto _ : state) {
+        pending.store(1, std::memory_order_relaxed);
+        pool.execute([&pending]() { pending.fetch_sub(1, std::memory_order_release); });
+        waitFor(pending);
+    }
+}
+BENCHMARK(BM_SpawnLatency_WorkStealing)->UseRealTime();
+
+void BM_ForkJoin_StdAsync(benchmark::State& state) {
+    std::vector<std::future<unsigned>> futures;
+    futures.reserve(ForkJoinTasks);
+    for (auto _ : state) {
+        for (int task = 0; task < ForkJoinTasks; ++task) {
+            futures.push_back(std::async(std::launch::async, [task]() { return work(static_cast<unsigned>(task), 256); }));
+        }
+        for (auto& future : futures) {
+            benchmark::DoNotOptimize(future.get());
+        }
+        futures.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * ForkJoinTasks);
+}
+BENCHMARK(BM_ForkJoin_StdAsync)->UseRealTime();
+
+void BM_ForkJoin_WorkStealing(benchmark::State& state) {
+    yafl::executor::WorkStealingExecutor pool;
+    std::atomic<int> pending{0};
+    for (auto _ : state) {
+        pending.store(ForkJoinTasks, std::memory_order_relaxed);
+        for (int task = 0; task < ForkJoinTasks; ++task) {
+            pool.execute([&pending, task]() {
+                benchmark::DoNotOptimize(work(static_cast<unsigned>(task), 256));
+                pending.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        waitFor(pending);
+    }
+    state.SetItemsProcessed(state.iterations() * ForkJoinTasks);
+}
+BENCHMARK(BM_ForkJoin_WorkStealing)->UseRealTime();
+
+/// Recursive fork-join from inside the pool: tasks spawn their children into their own deque
+/// and idle workers steal them. The argument is the number of workers
+void BM_ForkJoinScaling_WorkStealing(benchmark::State& state) {
+    constexpr int Tasks = 4096;
+    yafl::executor::WorkStealingExecutor pool(static_cast<std::size_t>(state.range(0)));
+    std::atomic<int> pending{0};
+    for (auto _ : state) {
+        pending.store(Tasks, std::memory_order_relaxed);
+        pool.execute([&pool, &pending]() { forkJoin(pool, pending, 0, Tasks, 1024); });
+        waitFor(pending);
+    }
+    state.SetItemsProcessed(state.iterations() * Tasks);
+}
+BENCHMARK(BM_ForkJoinScaling_WorkStealing)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+} // namespace
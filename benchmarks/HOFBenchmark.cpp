@@ -0,0 +1,110 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "Payloads.h"
+#include "yafl/HOF.h"
+#include "yafl/Maybe.h"
+#include <optional>
+#include <benchmark/benchmark.h>
+
+using namespace bench;
+
+namespace {
+
+template<typename T>
+void BM_Compose_Baseline(benchmark::State& state) {
+    const auto f = [](T v) { return mutate(std::move(v)); };
+    const auto g = [](T v) { return mutate(std::move(v)); };
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g(f(payload)));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_Compose_Baseline);
+
+template<typename T>
+void BM_Compose_Yafl(benchmark::State& state) {
+    const auto f = [](T v) { return mutate(std::move(v)); };
+    const auto g = [](T v) { return mutate(std::move(v)); };
+    const auto composed = yafl::compose(f, g);
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(composed(T(payload)));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_Compose_Yafl);
+
+template<typename T>
+void BM_KleisliCompose_Baseline(benchmark::State& state) {
+    const auto f = [](T v) { return std::optional<T>(mutate(std::move(v))); };
+    const auto g = [](T v) { return std::optional<T>(mutate(std::move(v))); };
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        auto intermediate = f(payload);
+        benchmark::DoNotOptimize(intermediate ? g(std::move(*intermediate)) : std::nullopt);
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_KleisliCompose_Baseline);
+
+template<typename T>
+void BM_KleisliCompose_Yafl(benchmark::State& state) {
+    const auto f = [](T v) { return yafl::Maybe<T>::Just(mutate(std::move(v))); };
+    const auto g = [](T v) { return yafl::Maybe<T>::Just(mutate(std::move(v))); };
+    const auto composed = yafl::kleisli_compose(f, g);
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(composed(payload));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_KleisliCompose_Yafl);
+
+template<typename T>
+void BM_Curry_Baseline(benchmark::State& state) {
+    const auto f = [](T v, int i) { return combine(std::move(v), i); };
+    const T payload = makePayload<T>();
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f(payload, i++));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_Curry_Baseline);
+
+template<typename T>
+void BM_Curry_Yafl(benchmark::State& state) {
+    const auto f = [](T v, int i) { return combine(std::move(v), i); };
+    const auto curried = yafl::curry(f);
+    const T payload = makePayload<T>();
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(curried(payload)(i++));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_Curry_Yafl);
+
+template<typename T>
+void BM_Partial_Baseline(benchmark::State& state) {
+    const auto f = [](T v, int i) { return combine(std::move(v), i); };
+    const T payload = makePayload<T>();
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f(payload, i++));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_Partial_Baseline);
+
+template<typename T>
+void BM_Partial_Yafl(benchmark::State& state) {
+    const auto f = [](T v, int i) { return combine(std::move(v), i); };
+    const auto partial = yafl::partial(f, makePayload<T>());
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(partial(i++));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_Partial_Yafl);
+
+} // namespace
@@ -0,0 +1,168 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "Payloads.h"
+#include "yafl/HOF.h"
+#include "yafl/Maybe.h"
+#include "yafl/Either.h"
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <benchmark/benchmark.h>
+
+using namespace bench;
+
+/**
+ * Lift implementation as it was before lifting became a single pass: check every argument
+ * with all, copy every value into a tuple through map_append and std::apply it.
+ * Kept only as a baseline for comparison.
+ */
+namespace tuple_lift {
+
+template<typename Callable>
+decltype(auto) maybe_lift(Callable&& callable) {
+    using ReturnType = typename yafl::function::Info<Callable>::ReturnType;
+    using LiftedArgsTuple = typename yafl::function::Info<Callable>::template LiftedArgTypes<yafl::Maybe>;
+
+    return yafl::function::make_closure<yafl::Maybe<ReturnType>, LiftedArgsTuple>([callable = std::forward<Callable>(callable)](auto&& ...args) -> yafl::Maybe<ReturnType> {
+        if (yafl::all([](auto &&v) { return v.hasValue(); }, args...)) {
+            auto tp = yafl::tuple::map_append([](auto&& arg) { return std::forward<decltype(arg)>(arg).value(); },
+                                              std::make_tuple(), std::forward<decltype(args)>(args)...);
+            return yafl::Maybe<ReturnType>::Just(std::apply(callable, std::move(tp)));
+        } else {
+            return yafl::Maybe<ReturnType>::Nothing();
+        }
+    });
+}
+
+template<typename ErrorType, typename Head>
+ErrorType getFailedValue(const Head& head) {
+    return head.error();
+}
+
+template<typename ErrorType, typename Head, typename ...Tail>
+ErrorType getFailedValue(const Head& head, Tail&& ...tail) {
+    if (head.isError()) {
+        return head.error();
+    } else {
+        return getFailedValue<ErrorType>(std::forward<Tail>(tail)...);
+    }
+}
+
+template<typename ErrorType, typename Callable>
+decltype(auto) either_lift(Callable&& callable) {
+    using ReturnType = typename yafl::function::Info<Callable>::ReturnType;
+    using PinErrorType = typename yafl::type::PinErrorType<ErrorType>;
+    using LiftedArgsTuple = typename yafl::function::Info<Callable>::template LiftedArgTypes<PinErrorType::template Type>;
+
+    return yafl::function::make_closure<yafl::Either<ErrorType, ReturnType>, LiftedArgsTuple>([callable = std::forward<Callable>(callable)](auto&& ...args) -> yafl::Either<ErrorType, ReturnType> {
+        if (yafl::all([](const auto &v) { return v.isOk(); }, args...)) {
+            auto tp = yafl::tuple::map_append([](auto&& arg) { return std::forward<decltype(arg)>(arg).value(); },
+                                              std::make_tuple(), std::forward<decltype(args)>(args)...);
+            return yafl::Either<ErrorType, ReturnType>::Ok(std::apply(callable, std::move(tp)));
+        } else {
+            return yafl::Either<ErrorType, ReturnType>::Error(getFailedValue<ErrorType>(args...));
+        }
+    });
+}
+
+} // namespace tuple_lift
+
+namespace {
+
+std::size_t weight(int value) { return static_cast<std::size_t>(value); }
+std::size_t weight(const Pod64& value) { return value.data[0]; }
+std::size_t weight(const String4K& value) { return value.size(); }
+
+template<std::size_t, typename T>
+using Arg = T;
+
+/// Callable with a fixed arity, as lift needs a concrete signature
+template<typename T, typename Indexes>
+struct Weigh;
+
+template<typename T, std::size_t ...Is>
+struct Weigh<T, std::index_sequence<Is...>> {
+    std::size_t operator()(const Arg<Is, T>& ...args) const { return (weight(args) + ...); }
+};
+
+template<typename T, std::size_t Arity>
+using WeighN = Weigh<T, std::make_index_sequence<Arity>>;
+
+template<typename Lifted, typename Wrapped, std::size_t ...Is>
+auto callLifted(const Lifted& lifted, const Wrapped& wrapped, const Wrapped& last, std::index_sequence<Is...>) {
+    return lifted(((void)Is, wrapped)..., last);
+}
+
+template<typename T, std::size_t Arity, typename Lifted, typename Wrapped>
+void runLift(benchmark::State& state, const Lifted& lifted, const Wrapped& wrapped, const Wrapped& last) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(callLifted(lifted, wrapped, last, std::make_index_sequence<Arity - 1>{}));
+    }
+}
+
+template<typename T, std::size_t Arity>
+void BM_MaybeLift_Tuple(benchmark::State& state) {
+    const auto value = yafl::maybe::Just(makePayload<T>());
+    runLift<T, Arity>(state, tuple_lift::maybe_lift(WeighN<T, Arity>{}), value, value);
+}
+
+template<typename T, std::size_t Arity>
+void BM_MaybeLift_Direct(benchmark::State& state) {
+    const auto value = yafl::maybe::Just(makePayload<T>());
+    runLift<T, Arity>(state, yafl::maybe::lift(WeighN<T, Arity>{}), value, value);
+}
+
+template<typename T, std::size_t Arity>
+void BM_EitherLift_Tuple(benchmark::State& state) {
+    const auto value = yafl::Either<std::string, T>::Ok(makePayload<T>());
+    runLift<T, Arity>(state, tuple_lift::either_lift<std::string>(WeighN<T, Arity>{}), value, value);
+}
+
+template<typename T, std::size_t Arity>
+void BM_EitherLift_Direct(benchmark::State& state) {
+    const auto value = yafl::Either<std::string, T>::Ok(makePayload<T>());
+    runLift<T, Arity>(state, yafl::either::lift<std::string>(WeighN<T, Arity>{}), value, value);
+}
+
+// Only the last argument fails, so every argument has to be checked
+template<typename T, std::size_t Arity>
+void BM_EitherLiftLastError_Tuple(benchmark::State& state) {
+    const auto value = yafl::Either<std::string, T>::Ok(makePayload<T>());
+    const auto error = yafl::Either<std::string, T>::Error("failed");
+    runLift<T, Arity>(state, tuple_lift::either_lift<std::string>(WeighN<T, Arity>{}), value, error);
+}
+
+template<typename T, std::size_t Arity>
+void BM_EitherLiftLastError_Direct(benchmark::State& state) {
+    const auto value = yafl::Either<std::string, T>::Ok(makePayload<T>());
+    const auto error = yafl::Either<std::string, T>::Error("failed");
+    runLift<T, Arity>(state, yafl::either::lift<std::string>(WeighN<T, Arity>{}), value, error);
+}
+
+#define YAFL_BENCHMARK_ARITIES(func, T) \
+    BENCHMARK_TEMPLATE(func, T, 1);     \
+    BENCHMARK_TEMPLATE(func, T, 2);     \
+    BENCHMARK_TEMPLATE(func, T, 3);     \
+    BENCHMARK_TEMPLATE(func, T, 4);     \
+    BENCHMARK_TEMPLATE(func, T, 5);     \
+    BENCHMARK_TEMPLATE(func, T, 6);     \
+    BENCHMARK_TEMPLATE(func, T, 7);     \
+    BENCHMARK_TEMPLATE(func, T, 8)
+
+YAFL_BENCHMARK_ARITIES(BM_MaybeLift_Tuple, int);
+YAFL_BENCHMARK_ARITIES(BM_MaybeLift_Direct, int);
+YAFL_BENCHMARK_ARITIES(BM_MaybeLift_Tuple, bench::String4K);
+YAFL_BENCHMARK_ARITIES(BM_MaybeLift_Direct, bench::String4K);
+YAFL_BENCHMARK_ARITIES(BM_EitherLift_Tuple, bench::Pod64);
+YAFL_BENCHMARK_ARITIES(BM_EitherLift_Direct, bench::Pod64);
+YAFL_BENCHMARK_ARITIES(BM_EitherLift_Tuple, bench::String4K);
+YAFL_BENCHMARK_ARITIES(BM_EitherLift_Direct, bench::String4K);
+YAFL_BENCHMARK_ARITIES(BM_EitherLiftLastError_Tuple, int);
+YAFL_BENCHMARK_ARITIES(BM_EitherLiftLastError_Direct, int);
+
+} // namespace
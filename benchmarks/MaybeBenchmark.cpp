@@ -0,0 +1,149 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "Payloads.h"
+#include "yafl/HOF.h"
+#include "yafl/Maybe.h"
+#include <optional>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+using namespace bench;
+
+namespace {
+
+template<typename T>
+void BM_MaybeFmap_Baseline(benchmark::State& state) {
+    const std::optional<T> opt = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(opt ? std::optional<T>(mutate(*opt)) : std::nullopt);
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeFmap_Baseline);
+
+template<typename T>
+void BM_MaybeFmap_Yafl(benchmark::State& state) {
+    const auto maybe = yafl::Maybe<T>::Just(makePayload<T>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(maybe.fmap([](T v) { return mutate(std::move(v)); }));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeFmap_Yafl);
+
+template<typename T>
+void BM_MaybeFmapChain_Baseline(benchmark::State& state) {
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        std::optional<T> opt = payload;
+        for (int stage = 0; stage < 4 && opt; ++stage) {
+            opt = mutate(std::move(*opt));
+        }
+        benchmark::DoNotOptimize(opt);
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeFmapChain_Baseline);
+
+template<typename T>
+void BM_MaybeFmapChain_Yafl(benchmark::State& state) {
+    const auto f = [](T v) { return mutate(std::move(v)); };
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yafl::Maybe<T>::Just(payload).fmap(f).fmap(f).fmap(f).fmap(f));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeFmapChain_Yafl);
+
+template<typename T>
+void BM_MaybeBind_Baseline(benchmark::State& state) {
+    const auto f = [](T v) { return std::optional<T>(mutate(std::move(v))); };
+    const std::optional<T> opt = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(opt ? f(*opt) : std::nullopt);
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeBind_Baseline);
+
+template<typename T>
+void BM_MaybeBind_Yafl(benchmark::State& state) {
+    const auto f = [](T v) { return yafl::Maybe<T>::Just(mutate(std::move(v))); };
+    const auto maybe = yafl::Maybe<T>::Just(makePayload<T>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(maybe.bind(f));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeBind_Yafl);
+
+template<typename T>
+void BM_MaybeLift_Baseline(benchmark::State& state) {
+    const auto f = [](T v, int i) { return combine(std::move(v), i); };
+    const std::optional<T> lhs = makePayload<T>();
+    const std::optional<int> rhs = 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize((lhs && rhs) ? std::optional<T>(f(*lhs, *rhs)) : std::nullopt);
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeLift_Baseline);
+
+template<typename T>
+void BM_MaybeLift_Yafl(benchmark::State& state) {
+    const auto lifted = yafl::maybe::lift([](T v, int i) { return combine(std::move(v), i); });
+    const auto lhs = yafl::Maybe<T>::Just(makePayload<T>());
+    const auto rhs = yafl::maybe::Just(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lifted(lhs, rhs));
+    }
+}
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeLift_Yafl);
+
+constexpr int AccessCount = 1024;
+
+void BM_MaybeAccess_Baseline(benchmark::State& state) {
+    std::vector<std::optional<int>> values;
+    for (int i = 0; i < AccessCount; ++i) {
+        values.push_back(i % 8 == 0 ? std::nullopt : std::optional<int>(i));
+    }
+    for (auto _ : state) {
+        int sum = 0;
+        for (const auto& value : values) {
+            if (value) sum += *value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_MaybeAccess_Baseline);
+
+void BM_MaybeAccess_Value(benchmark::State& state) {
+    std::vector<yafl::Maybe<int>> values;
+    for (int i = 0; i < AccessCount; ++i) {
+        values.push_back(i % 8 == 0 ? yafl::Maybe<int>::Nothing() : yafl::Maybe<int>::Just(i));
+    }
+    for (auto _ : state) {
+        int sum = 0;
+        for (const auto& value : values) {
+            if (value.hasValue()) sum += value.value();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_MaybeAccess_Value);
+
+void BM_MaybeAccess_Unchecked(benchmark::State& state) {
+    std::vector<yafl::Maybe<int>> values;
+    for (int i = 0; i < AccessCount; ++i) {
+        values.push_back(i % 8 == 0 ? yafl::Maybe<int>::Nothing() : yafl::Maybe<int>::Just(i));
+    }
+    for (auto _ : state) {
+        int sum = 0;
+        for (const auto& value : values) {
+            if (value.hasValue()) sum += *value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_MaybeAccess_Unchecked);
+
+} // namespace
@@ -0,0 +1,189 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Maybe.h"
+#include "yafl/MaybeVector.h"
+#include "yafl/MaybeVectorKernels.h"
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+constexpr std::size_t ColumnSize = 1 << 16;
+
+/// One missing value every nullEvery elements, none when nullEvery is 0
+std::vector<yafl::Maybe<double>> makeRows(std::size_t nullEvery) {
+    std::vector<yafl::Maybe<double>> rows;
+    rows.reserve(ColumnSize);
+    for (std::size_t i = 0; i < ColumnSize; ++i) {
+        rows.push_back(nullEvery != 0 && i % nullEvery == 0 ? yafl::Maybe<double>::Nothing()
+                                                            : yafl::maybe::Just(static_cast<double>(i)));
+    }
+    return rows;
+}
+
+yafl::MaybeVector<double> makeColumn(std::size_t nullEvery) {
+    yafl::MaybeVector<double> column;
+    column.reserve(ColumnSize);
+    for (const auto& row : makeRows(nullEvery)) {
+        column.push_back(row);
+    }
+    return column;
+}
+
+void BM_NullableFmap_VectorOfMaybe(benchmark::State& state) {
+    const auto rows = makeRows(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<yafl::Maybe<double>> result;
+        result.reserve(rows.size());
+        for (const auto& row : rows) {
+            result.push_back(row.fmap([](double d) { return d * 1.5 + 1.0; }));
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ColumnSize));
+}
+BENCHMARK(BM_NullableFmap_VectorOfMaybe)->Arg(0)->Arg(10);
+
+void BM_NullableFmap_MaybeVector(benchmark::State& state) {
+    const auto column = makeColumn(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(column.fmap([](double d) { return d * 1.5 + 1.0; }));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ColumnSize));
+}
+BENCHMARK(BM_NullableFmap_MaybeVector)->Arg(0)->Arg(10);
+
+void BM_NullableLift_VectorOfMaybe(benchmark::State& state) {
+    const auto lhs = makeRows(static_cast<std::size_t>(state.range(0)));
+    const auto rhs = makeRows(static_cast<std::size_t>(state.range(0)));
+    const auto add = yafl::maybe::lift([](double a, double b) { return a + b; });
+    for (auto _ : state) {
+        std::vector<yafl::Maybe<double>> result;
+        result.reserve(lhs.size());
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            result.push_back(add(lhs[i], rhs[i]));
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ColumnSize));
+}
+BENCHMARK(BM_NullableLift_VectorOfMaybe)->Arg(0)->Arg(10);
+
+void BM_NullableLift_MaybeVector(benchmark::State& state) {
+    const auto lhs = makeColumn(static_cast<std::size_t>(state.range(0)));
+    const auto rhs = makeColumn(static_cast<std::size_t>(state.range(0)));
+    const auto add = yafl::maybe_vector::lift([](double a, double b) { return a + b; });
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(add(lhs, rhs));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ColumnSize));
+}
+BENCHMARK(BM_NullableLift_MaybeVector)->Arg(0)->Arg(10);
+
+/// Float rows with one missing value every 10 elements
+std::vector<yafl::Maybe<float>> makeFloatRows() {
+    std::vector<yafl::Maybe<float>> rows;
+    rows.reserve(ColumnSize);
+    for (std::size_t i = 0; i < ColumnSize; ++i) {
+        rows.push_back(i % 10 == 0 ? yafl::Maybe<float>::Nothing()
+                                   : yafl::maybe::Just(static_cast<float>(i % 1000) + 1.0f));
+    }
+    return rows;
+}
+
+yafl::MaybeVector<float> makeFloatColumn() {
+    yafl::MaybeVector<float> column;
+    column.reserve(ColumnSize);
+    for (const auto& row : makeFloatRows()) {
+        column.push_back(row);
+    }
+    return column;
+}
+
+template <typename Callable>
+void runVectorOfMaybe(benchmark::State& state, Callable&& callable) {
+    const auto lhs = makeFloatRows();
+    const auto rhs = makeFloatRows();
+    const auto lifted = yafl::maybe::lift(std::forward<Callable>(callable));
+    using Result = decltype(lifted(lhs[0], rhs[0]));
+    for (auto _ : state) {
+        std::vector<Result> result;
+        result.reserve(lhs.size());
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            result.push_back(lifted(lhs[i], rhs[i]));
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ColumnSize));
+}
+
+template <typename Kernel>
+void runKernel(benchmark::State& state, Kernel&& kernel) {
+    const auto active = yafl::maybe_vector::activeIsa();
+    if (!yafl::maybe_vector::selectIsa(static_cast<yafl::maybe_vector::Isa>(state.range(0)))) {
+        state.SkipWithError("instruction set not supported");
+        return;
+    }
+    const auto lhs = makeFloatColumn();
+    const auto rhs = makeFloatColumn();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kernel(lhs, rhs));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ColumnSize));
+    yafl::maybe_vector::selectIsa(active);
+}
+
+/// Kernel benchmarks take the instruction set as argument: 0 scalar, 1 SSE4.2, 2 AVX2
+#define YAFL_BENCHMARK_ISAS ->Arg(0)->Arg(1)->Arg(2)
+
+void BM_KernelAdd_VectorOfMaybe(benchmark::State& state) {
+    runVectorOfMaybe(state, [](float a, float b) { return a + b; });
+}
+BENCHMARK(BM_KernelAdd_VectorOfMaybe);
+
+void BM_KernelAdd_MaybeVector(benchmark::State& state) {
+    runKernel(state, [](const auto& a, const auto& b) { return yafl::maybe_vector::add(a, b); });
+}
+BENCHMARK(BM_KernelAdd_MaybeVector) YAFL_BENCHMARK_ISAS;
+
+void BM_KernelDiv_VectorOfMaybe(benchmark::State& state) {
+    runVectorOfMaybe(state, [](float a, float b) { return a / b; });
+}
+BENCHMARK(BM_KernelDiv_VectorOfMaybe);
+
+void BM_KernelDiv_MaybeVector(benchmark::State& state) {
+    runKernel(state, [](const auto& a, const auto& b) { return yafl::maybe_vector::div(a, b); });
+}
+BENCHMARK(BM_KernelDiv_MaybeVector) YAFL_BENCHMARK_ISAS;
+
+void BM_KernelFma_VectorOfMaybe(benchmark::State& state) {
+    runVectorOfMaybe(state, [](float a, float b) { return std::fma(a, b, a); });
+}
+BENCHMARK(BM_KernelFma_VectorOfMaybe);
+
+void BM_KernelFma_MaybeVector(benchmark::State& state) {
+    runKernel(state, [](const auto& a, const auto& b) { return yafl::maybe_vector::fma(a, b, a); });
+}
+BENCHMARK(BM_KernelFma_MaybeVector) YAFL_BENCHMARK_ISAS;
+
+void BM_KernelLess_VectorOfMaybe(benchmark::State& state) {
+    runVectorOfMaybe(state, [](float a, float b) { return a < b; });
+}
+BENCHMARK(BM_KernelLess_VectorOfMaybe);
+
+void BM_KernelLess_MaybeVector(benchmark::State& state) {
+    runKernel(state, [](const auto& a, const auto& b) {
+        return yafl::maybe_vector::compare(a, b, yafl::maybe_vector::Comparison::Less);
+    });
+}
+BENCHMARK(BM_KernelLess_MaybeVector) YAFL_BENCHMARK_ISAS;
+
+} // namespace
@@ -0,0 +1,64 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Either.h"
+#include "yafl/Parallel.h"
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+std::vector<int> makeRecords(std::size_t size) {
+    std::vector<int> records(size);
+    std::iota(records.begin(), records.end(), 0);
+    return records;
+}
+
+/// Validation with some work per record, failing only for negative records
+yafl::Either<std::string, int> validate(int record) {
+    if (record < 0) {
+        return yafl::Either<std::string, int>::Error("negative record");
+    }
+    unsigned hash = static_cast<unsigned>(record);
+    for (int i = 0; i < 64; ++i) {
+        hash = hash * 31U + 7U;
+    }
+    return yafl::Either<std::string, int>::Ok(static_cast<int>(hash >> 1U));
+}
+
+void BM_Traverse_Sequential(benchmark::State& state) {
+    const auto records = makeRecords(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yafl::either::traverse(records, validate));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Traverse_Sequential)->RangeMultiplier(10)->Range(100000, 10000000)->Unit(benchmark::kMillisecond);
+
+void BM_Traverse_Parallel(benchmark::State& state) {
+    const auto records = makeRecords(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yafl::parallel::traverse(records, validate));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Traverse_Parallel)->RangeMultiplier(10)->Range(100000, 10000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Error right after the start of the range: the other chunks are cancelled
+void BM_TraverseEarlyError_Parallel(benchmark::State& state) {
+    auto records = makeRecords(static_cast<std::size_t>(state.range(0)));
+    records[10] = -1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yafl::parallel::traverse(records, validate));
+    }
+}
+BENCHMARK(BM_TraverseEarlyError_Parallel)->RangeMultiplier(10)->Range(100000, 10000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
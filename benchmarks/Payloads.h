@@ -0,0 +1,79 @@
+/**
+ * \brief       Payload types shared by the Yafl benchmarks
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <benchmark/benchmark.h>
+
+namespace bench {
+
+/// Trivially copyable payload with 64 bytes
+struct Pod64 {
+    std::array<std::uint64_t, 8> data;
+};
+
+/// Heap allocated payload with 4 KB
+using String4K = std::string;
+
+/**
+ * Creates a payload of type T
+ * @tparam T payload type
+ * @return payload instance
+ */
+template<typename T>
+T makePayload();
+
+template<>
+inline int makePayload<int>() { return 42; }
+
+template<>
+inline Pod64 makePayload<Pod64>() { return Pod64{{1, 2, 3, 4, 5, 6, 7, 8}}; }
+
+template<>
+inline String4K makePayload<String4K>() { return String4K(4096, 'y'); }
+
+/**
+ * Cheap transformation applied to each payload so that benchmarks measure
+ * the cost of the plumbing rather than the cost of the work
+ */
+inline int mutate(int value) { return value + 1; }
+
+inline Pod64 mutate(Pod64 value) {
+    ++value.data[0];
+    return value;
+}
+
+inline String4K mutate(String4K value) {
+    ++value[0];
+    return value;
+}
+
+/**
+ * Transformation that combines a payload with an int
+ */
+template<typename T>
+T combine(T value, int i) {
+    if constexpr (std::is_same_v<T, int>) {
+        return value + i;
+    } else if constexpr (std::is_same_v<T, Pod64>) {
+        value.data[0] += static_cast<std::uint64_t>(i);
+        return value;
+    } else {
+        value[0] = static_cast<char>(value[0] + i);
+        return value;
+    }
+}
+
+} // namespace bench
+
+/// Registers the given benchmark template for every payload type
+#define YAFL_BENCHMARK_PAYLOADS(func)            \
+    BENCHMARK_TEMPLATE(func, int);               \
+    BENCHMARK_TEMPLATE(func, bench::Pod64);      \
+    BENCHMARK_TEMPLATE(func, bench::String4K)
@@ -0,0 +1,92 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "Payloads.h"
+#include "yafl/HOF.h"
+#include "yafl/Maybe.h"
+#include <utility>
+#include <benchmark/benchmark.h>
+
+using namespace bench;
+
+namespace {
+
+template<std::size_t Depth, typename Stage>
+auto nestedCompose(const Stage& stage) {
+    if constexpr (Depth == 1) {
+        return stage;
+    } else {
+        return yafl::compose(nestedCompose<Depth - 1>(stage), stage);
+    }
+}
+
+template<typename First, typename Stage, std::size_t ...Is>
+auto flatPipeline(const First& first, const Stage& stage, std::index_sequence<Is...>) {
+    return yafl::pipeline(first, ((void)Is, stage)...);
+}
+
+template<typename T>
+auto makeStage() {
+    return [](T v) { return yafl::Maybe<T>::Just(mutate(std::move(v))); };
+}
+
+template<typename T>
+auto makeFailingStage() {
+    return [](T) { return yafl::Maybe<T>::Nothing(); };
+}
+
+template<typename T, std::size_t Depth>
+void BM_Pipeline_Nested(benchmark::State& state) {
+    const auto composed = nestedCompose<Depth>(makeStage<T>());
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(composed(payload));
+    }
+}
+
+template<typename T, std::size_t Depth>
+void BM_Pipeline_Flat(benchmark::State& state) {
+    const auto composed = flatPipeline(makeStage<T>(), makeStage<T>(), std::make_index_sequence<Depth - 1>{});
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(composed(payload));
+    }
+}
+
+template<typename T, std::size_t Depth>
+void BM_PipelineEarlyExit_Nested(benchmark::State& state) {
+    const auto composed = yafl::compose(makeFailingStage<T>(), nestedCompose<Depth - 1>(makeStage<T>()));
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(composed(payload));
+    }
+}
+
+template<typename T, std::size_t Depth>
+void BM_PipelineEarlyExit_Flat(benchmark::State& state) {
+    const auto composed = flatPipeline(makeFailingStage<T>(), makeStage<T>(), std::make_index_sequence<Depth - 1>{});
+    const T payload = makePayload<T>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(composed(payload));
+    }
+}
+
+#define YAFL_BENCHMARK_DEPTHS(func, T) \
+    BENCHMARK_TEMPLATE(func, T, 2);    \
+    BENCHMARK_TEMPLATE(func, T, 4);    \
+    BENCHMARK_TEMPLATE(func, T, 8);    \
+    BENCHMARK_TEMPLATE(func, T, 16);   \
+    BENCHMARK_TEMPLATE(func, T, 32)
+
+YAFL_BENCHMARK_DEPTHS(BM_Pipeline_Nested, int);
+YAFL_BENCHMARK_DEPTHS(BM_Pipeline_Flat, int);
+YAFL_BENCHMARK_DEPTHS(BM_Pipeline_Nested, bench::String4K);
+YAFL_BENCHMARK_DEPTHS(BM_Pipeline_Flat, bench::String4K);
+YAFL_BENCHMARK_DEPTHS(BM_PipelineEarlyExit_Nested, bench::String4K);
+YAFL_BENCHMARK_DEPTHS(BM_PipelineEarlyExit_Flat, bench::String4K);
+
+} // namespace
@@ -0,0 +1,115 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Either.h"
+#include "yafl/Stream.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+enum class ErrorCode { Invalid };
+
+using Result = yafl::Either<ErrorCode, std::int64_t>;
+
+std::vector<std::int64_t> makeValues(std::size_t size) {
+    std::vector<std::int64_t> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+const auto scale = [](std::int64_t value) { return value * 3 + 1; };
+const auto isEven = [](std::int64_t value) { return value % 2 == 0; };
+const auto square = [](std::int64_t value) { return value * value; };
+const auto sum = [](std::int64_t acc, std::int64_t value) { return acc + value; };
+
+/// fmap -> filter -> fmap -> fold, materializing a vector between every step
+void BM_StreamPipeline_Vector(benchmark::State& state) {
+    const auto values = makeValues(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<std::int64_t> scaled;
+        scaled.reserve(values.size());
+        std::transform(values.begin(), values.end(), std::back_inserter(scaled), scale);
+        std::vector<std::int64_t> even;
+        std::copy_if(scaled.begin(), scaled.end(), std::back_inserter(even), isEven);
+        std::vector<std::int64_t> squared;
+        squared.reserve(even.size());
+        std::transform(even.begin(), even.end(), std::back_inserter(squared), square);
+        benchmark::DoNotOptimize(std::accumulate(squared.begin(), squared.end(), std::int64_t{0}, sum));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StreamPipeline_Vector)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+void BM_StreamPipeline_Stream(benchmark::State& state) {
+    const auto values = makeValues(static_cast<std::size_t>(state.range(0)));
+    const auto pipeline = yafl::stream::from(values).fmap(scale).filter(isEven).fmap(square);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pipeline.fold(std::int64_t{0}, sum));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StreamPipeline_Stream)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+/// Hand written loop, the lower bound of the fused pipeline
+void BM_StreamPipeline_Loop(benchmark::State& state) {
+    const auto values = makeValues(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::int64_t total = 0;
+        for (const auto value : values) {
+            const auto scaled = scale(value);
+            if (isEven(scaled)) {
+                total = sum(total, square(scaled));
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StreamPipeline_Loop)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+/// Validates every element and sums them, the error sits in the middle of the input
+const auto validate = [](std::int64_t value) {
+    return value == 1 << 19 ? Result::Error(ErrorCode::Invalid) : Result::Ok(value);
+};
+
+void BM_StreamTryFold_Vector(benchmark::State& state) {
+    const auto values = makeValues(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<Result> validated;
+        validated.reserve(values.size());
+        std::transform(values.begin(), values.end(), std::back_inserter(validated), validate);
+        Result total = Result::Ok(0);
+        for (const auto& result : validated) {
+            if (!result) {
+                total = result;
+                break;
+            }
+            total = Result::Ok(*total + *result);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StreamTryFold_Vector)->Arg(1 << 20);
+
+void BM_StreamTryFold_Stream(benchmark::State& state) {
+    const auto values = makeValues(static_cast<std::size_t>(state.range(0)));
+    const auto validated = yafl::stream::from(values).fmap(validate);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validated.tryFold(std::int64_t{0}, sum));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StreamTryFold_Stream)->Arg(1 << 20);
+
+} // namespace
@@ -0,0 +1,136 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "Payloads.h"
+#include "yafl/Maybe.h"
+#include "yafl/Either.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+using namespace bench;
+
+namespace {
+
+constexpr std::size_t RangeSize = 1024;
+
+template<typename T>
+std::vector<yafl::Maybe<T>> makeMaybes(std::size_t failAt) {
+    std::vector<yafl::Maybe<T>> maybes;
+    for (std::size_t i = 0; i < RangeSize; ++i) {
+        maybes.push_back(i == failAt ? yafl::Maybe<T>::Nothing() : yafl::maybe::Just(makePayload<T>()));
+    }
+    return maybes;
+}
+
+template<typename T>
+std::vector<yafl::Either<std::string, T>> makeEithers(std::size_t failAt) {
+    std::vector<yafl::Either<std::string, T>> eithers;
+    for (std::size_t i = 0; i < RangeSize; ++i) {
+        eithers.push_back(i == failAt ? yafl::Either<std::string, T>::Error("failed") : yafl::Either<std::string, T>::Ok(makePayload<T>()));
+    }
+    return eithers;
+}
+
+template<typename T>
+auto checkedMutate(const T& value) {
+    return yafl::Either<std::string, T>::Ok(mutate(value));
+}
+
+/// Loop as usually hand-written: grows the vector on demand and copies every value out
+template<typename T>
+yafl::Maybe<std::vector<T>> handSequence(const std::vector<yafl::Maybe<T>>& maybes) {
+    std::vector<T> values;
+    for (const auto& maybe : maybes) {
+        if (!maybe.hasValue()) {
+            return yafl::Maybe<std::vector<T>>::Nothing();
+        }
+        values.push_back(maybe.value());
+    }
+    return yafl::maybe::Just(std::move(values));
+}
+
+template<typename T>
+yafl::Either<std::string, std::vector<T>> handTraverse(const std::vector<T>& values) {
+    std::vector<T> results;
+    for (const auto& value : values) {
+        const auto result = checkedMutate(value);
+        if (result.isError()) {
+            return yafl::Either<std::string, std::vector<T>>::Error(result.error());
+        }
+        results.push_back(result.value());
+    }
+    return yafl::Either<std::string, std::vector<T>>::Ok(std::move(results));
+}
+
+template<typename T>
+void BM_MaybeSequence_Loop(benchmark::State& state) {
+    const auto maybes = makeMaybes<T>(RangeSize);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handSequence(maybes));
+    }
+}
+
+template<typename T>
+void BM_MaybeSequence_Yafl(benchmark::State& state) {
+    const auto maybes = makeMaybes<T>(RangeSize);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yafl::maybe::sequence(maybes));
+    }
+}
+
+// Nothing in the middle of the range
+template<typename T>
+void BM_MaybeSequenceNothing_Loop(benchmark::State& state) {
+    const auto maybes = makeMaybes<T>(RangeSize / 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handSequence(maybes));
+    }
+}
+
+template<typename T>
+void BM_MaybeSequenceNothing_Yafl(benchmark::State& state) {
+    const auto maybes = makeMaybes<T>(RangeSize / 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yafl::maybe::sequence(maybes));
+    }
+}
+
+template<typename T>
+void BM_EitherSequence_Yafl(benchmark::State& state) {
+    const auto eithers = makeEithers<T>(RangeSize);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yafl::either::sequence(eithers));
+    }
+}
+
+template<typename T>
+void BM_EitherTraverse_Loop(benchmark::State& state) {
+    const std::vector<T> values(RangeSize, makePayload<T>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handTraverse(values));
+    }
+}
+
+template<typename T>
+void BM_EitherTraverse_Yafl(benchmark::State& state) {
+    const std::vector<T> values(RangeSize, makePayload<T>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(yafl::either::traverse(values, [](const T& value) { return checkedMutate(value); }));
+    }
+}
+
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeSequence_Loop);
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeSequence_Yafl);
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeSequenceNothing_Loop);
+YAFL_BENCHMARK_PAYLOADS(BM_MaybeSequenceNothing_Yafl);
+YAFL_BENCHMARK_PAYLOADS(BM_EitherSequence_Yafl);
+YAFL_BENCHMARK_PAYLOADS(BM_EitherTraverse_Loop);
+YAFL_BENCHMARK_PAYLOADS(BM_EitherTraverse_Yafl);
+
+} // namespace
@@ -0,0 +1,249 @@
+#!/usr/bin/env python3
+"""
+Yet Another Functional Library
+
+Copyright 2023, Ernesto Festas.
+Distributed under MIT license (See accompanying LICENSE file)
+
+Compile-time benchmark of yafl template instantiation cost.
+
+Each scenario generates one translation unit per parameter value (composition depth, callable
+arity, nesting depth, ...). Every generated type and callable is distinct, so the compiler cannot
+reuse instantiations between the steps of a scenario. Each unit is compiled with -ftime-report (GCC)
+or -ftime-trace (Clang), and the front-end time, template instantiation time, wall time and peak
+compiler memory are recorded in a JSON report. Passing a previous report with --compare prints the
+relative change of every entry, so a metaprogramming change can be checked against a budget.
+
+Usage:
+    compile_bench.py [--compiler c++] [--include <yafl src dir>] [--scenario name ...]
+                     [--repeat 1] [--output report.json] [--compare baseline.json]
+"""
+
+import argparse
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+PRELUDE = """#include "yafl/Either.h"
+#include "yafl/HOF.h"
+#include "yafl/Maybe.h"
+#include <string>
+
+template <int Tag> struct Arg { int value; };
+template <int Tag> struct Err {
+    int code;
+    bool operator==(const Err& other) const { return code == other.code; }
+};
+"""
+
+CALLABLES_PER_UNIT = 4
+TUPLES_PER_UNIT = 40
+
+
+def wide_callables(arity):
+    params = ", ".join(f"Arg<{i}> a{i}" for i in range(arity))
+    body = " + ".join(f"a{i}.value" for i in range(arity))
+    return [f"int f{c}({params}) {{ return {c} + {body}; }}" for c in range(CALLABLES_PER_UNIT)]
+
+
+def compose_depth(depth):
+    """compose(compose(f0, f1), f2)... over plain functions"""
+    lines = [f"inline auto s{i} = [](Arg<{i}> a) {{ return Arg<{i + 1}>{{a.value + 1}}; }};" for i in range(depth)]
+    chain = "s0"
+    for i in range(1, depth):
+        chain = f"yafl::compose({chain}, s{i})"
+    lines += ["", f"int run(int i) {{ return {chain}(Arg<0>{{i}}).value; }}"]
+    return lines
+
+
+def kleisli_depth(depth):
+    """compose(compose(f0, f1), f2)... over Either returning functions"""
+    lines = [f"inline auto s{i} = [](Arg<{i}> a) {{ return yafl::Either<Err<0>, Arg<{i + 1}>>::Ok(Arg<{i + 1}>{{a.value + 1}}); }};"
+             for i in range(depth)]
+    chain = "s0"
+    for i in range(1, depth):
+        chain = f"yafl::compose({chain}, s{i})"
+    lines += ["", f"int run(int i) {{ return {chain}(Arg<0>{{i}}).value().value; }}"]
+    return lines
+
+
+def partial_arity(arity):
+    """partial(f, a0, ..., ak) for every prefix of an arity-N callable"""
+    lines = wide_callables(arity) + ["", "void run() {"]
+    for c in range(CALLABLES_PER_UNIT):
+        for bound in range(1, arity):
+            args = ", ".join(f"Arg<{i}>{{{i}}}" for i in range(bound))
+            lines.append(f"    static_cast<void>(yafl::partial(f{c}, {args}));")
+    return lines + ["}"]
+
+
+def curry_arity(arity):
+    """curry(f)(a0)(a1)...(aN-1)"""
+    lines = wide_callables(arity) + ["", "int run() {", "    int total = 0;"]
+    calls = "".join(f"(Arg<{i}>{{{i}}})" for i in range(arity))
+    for c in range(CALLABLES_PER_UNIT):
+        lines.append(f"    total += yafl::curry(f{c}){calls};")
+    return lines + ["    return total;", "}"]
+
+
+def lift_arity(arity):
+    """maybe::lift(f) and either::lift<E>(f) applied to N wrapped arguments"""
+    lines = wide_callables(arity) + ["", "int run() {", "    int total = 0;"]
+    justs = ", ".join(f"yafl::Maybe<Arg<{i}>>::Just(Arg<{i}>{{{i}}})" for i in range(arity))
+    oks = ", ".join(f"yafl::Either<Err<0>, Arg<{i}>>::Ok(Arg<{i}>{{{i}}})" for i in range(arity))
+    for c in range(CALLABLES_PER_UNIT):
+        lines.append(f"    total += yafl::maybe::lift(f{c})({justs}).value();")
+        lines.append(f"    total += yafl::either::lift<Err<0>>(f{c})({oks}).value();")
+    return lines + ["    return total;", "}"]
+
+
+def nested_either(depth):
+    """Either<Err<N>, ... Either<Err<0>, int>>, built, mapped at the innermost level and compared"""
+    lines = ["using L0 = yafl::Either<Err<0>, int>;"]
+    lines += [f"using L{i} = yafl::Either<Err<{i}>, L{i - 1}>;" for i in range(1, depth + 1)]
+    value = "L0::Ok(1)"
+    for i in range(1, depth + 1):
+        value = f"L{i}::Ok({value})"
+    mapper = "[](int i) { return i + 1; }"
+    for _ in range(depth):
+        mapper = f"[](const auto& inner) {{ return inner.fmap({mapper}); }}"
+    unwrap = "".join(".value()" for _ in range(depth + 1))
+    lines += ["", "int run() {",
+              f"    const auto value = {value};",
+              f"    const auto mapped = value.fmap({mapper});",
+              f"    return mapped == value ? 0 : mapped{unwrap};",
+              "}"]
+    return lines
+
+
+def tuple_subset(arity):
+    """tuple::IsTupleSubset and tuple::TupleSubset alone, for every prefix of many distinct N-tuples"""
+    lines = ["template <int Tag, int Set> struct T {};"]
+    for k in range(TUPLES_PER_UNIT):
+        full = ", ".join(f"T<{i}, {k}>" for i in range(arity))
+        for bound in range(1, arity):
+            prefix = ", ".join(f"T<{i}, {k}>" for i in range(bound))
+            lines.append(f"static_assert(yafl::tuple::IsTupleSubset<std::tuple<{full}>, std::tuple<{prefix}>>::value);")
+            lines.append(f"static_assert(std::tuple_size_v<yafl::tuple::TupleSubset<{bound}, std::tuple<{full}>>> == {arity - bound});")
+    return lines
+
+
+SCENARIOS = {
+    "compose_depth": (compose_depth, [2, 4, 8, 16, 32]),
+    "kleisli_depth": (kleisli_depth, [2, 4, 8, 16, 32]),
+    "partial_arity": (partial_arity, [2, 4, 8, 12, 16]),
+    "curry_arity": (curry_arity, [2, 4, 8, 12, 16]),
+    "lift_arity": (lift_arity, [2, 4, 8, 12, 16]),
+    "nested_either": (nested_either, [1, 2, 4, 8]),
+    "tuple_subset": (tuple_subset, [2, 4, 8, 12, 16]),
+}
+
+
+def compiler_id(compiler):
+    version = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout.splitlines()[0]
+    return ("clang" if "clang" in version else "gcc"), version
+
+
+def parse_gcc_report(stderr):
+    """Sums the front-end phases of -ftime-report, wall column"""
+    phases = {}
+    for line in stderr.splitlines():
+        match = re.match(r"\s*(.+?)\s*:.*?\s([\d.]+)\s*\(\s*\d+%\)\s+[\d.]+[kMG]?\s*\(\s*\d+%\)\s*$", line)
+        if match:
+            phases[match.group(1)] = float(match.group(2))
+    frontend = sum(phases.get(name, 0.0) for name in ("phase setup", "phase parsing", "phase lang. deferred"))
+    return frontend, phases.get("template instantiation", 0.0)
+
+
+def parse_clang_trace(trace_path):
+    """Reads the totals of -ftime-trace, durations are in microseconds"""
+    with open(trace_path) as trace:
+        events = json.load(trace)["traceEvents"]
+    totals = {event["name"]: event["dur"] / 1e6 for event in events if event.get("name", "").startswith("Total ")}
+    instantiation = sum(totals.get(name, 0.0) for name in ("Total InstantiateClass", "Total InstantiateFunction"))
+    return totals.get("Total Frontend", 0.0), instantiation
+
+
+def compile_unit(options, kind, source):
+    output = os.path.splitext(source)[0] + ".o"
+    command = [options.compiler, f"-std={options.std}", "-O0", f"-I{options.include}", "-c", source, "-o", output]
+    command += ["-ftime-trace"] if kind == "clang" else ["-ftime-report"]
+    best = None
+    for _ in range(options.repeat):
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+        stderr = process.stderr.read()
+        _, status, usage = os.wait4(process.pid, 0)
+        wall = time.perf_counter() - start
+        if os.waitstatus_to_exitcode(status) != 0:
+            sys.exit(f"compilation failed: {' '.join(command)}\n" + "\n".join(stderr.splitlines()[:40]))
+        if kind == "clang":
+            frontend, instantiation = parse_clang_trace(os.path.splitext(source)[0] + ".json")
+        else:
+            frontend, instantiation = parse_gcc_report(stderr)
+        # ru_maxrss is in KiB on Linux
+        sample = {"wall_seconds": round(wall, 4), "frontend_seconds": round(frontend, 4),
+                  "instantiation_seconds": round(instantiation, 4), "peak_rss_kib": usage.ru_maxrss}
+        if best is None or sample["frontend_seconds"] < best["frontend_seconds"]:
+            best = sample
+    return best
+
+
+def compare(results, baseline_path):
+    with open(baseline_path) as baseline_file:
+        baseline = {(row["scenario"], row["parameter"]): row for row in json.load(baseline_file)["results"]}
+    print(f"\n{'scenario':<15} {'param':>5} {'frontend':>10} {'peak rss':>10}")
+    for row in results:
+        old = baseline.get((row["scenario"], row["parameter"]))
+        if old is None:
+            continue
+        time_change = (row["frontend_seconds"] / old["frontend_seconds"] - 1) * 100 if old["frontend_seconds"] else 0.0
+        memory_change = (row["peak_rss_kib"] / old["peak_rss_kib"] - 1) * 100
+        print(f"{row['scenario']:<15} {row['parameter']:>5} {time_change:>+9.1f}% {memory_change:>+9.1f}%")
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--include", default=os.path.normpath(os.path.join(here, "..", "..", "src")))
+    parser.add_argument("--std", default="c++17")
+    parser.add_argument("--repeat", type=int, default=1, help="keeps the run with the fastest front-end")
+    parser.add_argument("--scenario", action="append", choices=sorted(SCENARIOS), help="defaults to all of them")
+    parser.add_argument("--output", help="JSON report path")
+    parser.add_argument("--compare", help="previous JSON report to compare with")
+    options = parser.parse_args()
+
+    kind, version = compiler_id(options.compiler)
+    results = []
+    print(f"{'scenario':<15} {'param':>5} {'frontend':>9} {'instant.':>9} {'wall':>8} {'peak MiB':>9}")
+    with tempfile.TemporaryDirectory() as workdir:
+        for name in options.scenario or SCENARIOS:
+            generate, parameters = SCENARIOS[name]
+            for parameter in parameters:
+                source = os.path.join(workdir, f"{name}_{parameter}.cpp")
+                with open(source, "w") as unit:
+                    unit.write(PRELUDE + "\n" + "\n".join(generate(parameter)) + "\n")
+                row = {"scenario": name, "parameter": parameter, **compile_unit(options, kind, source)}
+                results.append(row)
+                print(f"{name:<15} {parameter:>5} {row['frontend_seconds']:>9.3f} {row['instantiation_seconds']:>9.3f} "
+                      f"{row['wall_seconds']:>8.3f} {row['peak_rss_kib'] / 1024:>9.1f}", flush=True)
+
+    report = {"compiler": {"path": options.compiler, "kind": kind, "version": version},
+              "std": options.std, "include": options.include, "host": platform.node(),
+              "date": time.strftime("%Y-%m-%dT%H:%M:%S"), "results": results}
+    if options.output:
+        with open(options.output, "w") as output:
+            json.dump(report, output, indent=2)
+        print(f"\nCompile benchmark report: {options.output}")
+    if options.compare:
+        compare(results, options.compare)
+
+
+if __name__ == "__main__":
+    main()
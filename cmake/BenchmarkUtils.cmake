@@ -0,0 +1,18 @@
+include(CMakeParseArguments)
+
+function(setup_benchmarking)
+    message(STATUS "Compile benchmarks: ${BUILD_YAFL_BENCHMARKS}")
+
+    include(FetchContent)
+
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+    FetchContent_Declare(
+        googlebenchmark
+        GIT_REPOSITORY https://github.com/google/benchmark.git
+        GIT_TAG v1.8.3)
+
+    FetchContent_MakeAvailable(googlebenchmark)
+endfunction()
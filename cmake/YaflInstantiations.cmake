@@ -0,0 +1,63 @@
+# Explicit instantiations of yafl types, compiled once in a static library
+#
+# yafl_add_instantiations(<target>
+#         HEADER <path>                     generated header, e.g, project/YaflTypes.h
+#         [MAYBE <type>...]                 Maybe<type> to instantiate
+#         [EITHER "<error>, <value>"...]    Either<error, value> to instantiate
+#         [INCLUDES <header>...]            headers defining the types, included as <header>
+#         [LINK <library>...])              libraries providing those headers
+#
+# Creates the static library <target> holding the explicit instantiation definitions, and generates HEADER with the
+# matching extern template declarations. Translation units that include HEADER, instead of yafl/Maybe.h and
+# yafl/Either.h, reuse the non template members of the listed types from <target> instead of emitting their own copy.
+# Every non template member is instantiated, so the types have to be copyable and equality comparable.
+function(yafl_add_instantiations target)
+    cmake_parse_arguments(ARG "" "HEADER" "MAYBE;EITHER;INCLUDES;LINK" ${ARGN})
+    if(NOT ARG_HEADER)
+        message(FATAL_ERROR "yafl_add_instantiations(${target}): HEADER is required")
+    endif()
+
+    set(YAFL_INCLUDES "")
+    foreach(header IN LISTS ARG_INCLUDES)
+        string(APPEND YAFL_INCLUDES "#include <${header}>\n")
+    endforeach()
+
+    set(YAFL_DECLARATIONS "")
+    set(YAFL_DEFINITIONS "")
+    foreach(type IN LISTS ARG_MAYBE)
+        string(APPEND YAFL_DECLARATIONS "extern template class yafl::Maybe<${type}>;\n")
+        string(APPEND YAFL_DEFINITIONS "template class yafl::Maybe<${type}>;\n")
+    endforeach()
+    foreach(types IN LISTS ARG_EITHER)
+        string(APPEND YAFL_DECLARATIONS "extern template class yafl::Either<${types}>;\n")
+        string(APPEND YAFL_DEFINITIONS "template class yafl::Either<${types}>;\n")
+    endforeach()
+
+    set(output_dir ${CMAKE_CURRENT_BINARY_DIR}/${target})
+    file(CONFIGURE OUTPUT ${output_dir}/include/${ARG_HEADER} @ONLY CONTENT [=[
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * Generated by yafl_add_instantiations(@target@), do not edit.
+ * Include this header instead of yafl/Maybe.h and yafl/Either.h and link @target@.
+ */
+#pragma once
+
+#include "yafl/Either.h"
+#include "yafl/Maybe.h"
+@YAFL_INCLUDES@
+@YAFL_DECLARATIONS@]=])
+    file(CONFIGURE OUTPUT ${output_dir}/${target}.cpp @ONLY CONTENT [=[
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * Generated by yafl_add_instantiations(@target@), do not edit
+ */
+#include "@ARG_HEADER@"
+
+@YAFL_DEFINITIONS@]=])
+
+    add_library(${target} STATIC ${output_dir}/${target}.cpp)
+    target_include_directories(${target} PUBLIC $<BUILD_INTERFACE:${output_dir}/include>)
+    target_link_libraries(${target} PUBLIC Yafl::Yafl ${ARG_LINK})
+endfunction()
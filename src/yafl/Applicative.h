@@ -8,8 +8,8 @@
  */
 #pragma once
 
-#include <memory>
-#include <functional>
+#include <utility>
+#include "yafl/TypeTraits.h"
 
 namespace yafl {
 namespace core {
@@ -32,7 +32,7 @@ public:
      * input arguments
      * @return result of inner function execution
      */
-    decltype(auto) operator()() const {
+    constexpr decltype(auto) operator()() const {
         return static_cast<const TDerivedApplicative<Args...> *>(this)->internal_apply();
     }
 
@@ -46,7 +46,7 @@ public:
      * @return a new Applicative Functor containing a new function with one input argument less
      */
     template<typename Head>
-    decltype(auto) operator()(Head&& head) const {
+    constexpr decltype(auto) operator()(Head&& head) const {
         return static_cast<const TDerivedApplicative<Args...> *>(this)->internal_apply(std::forward<Head>(head));
     }
 
@@ -62,7 +62,7 @@ public:
      * @return a new Applicative Functor containing a new function with one input argument less
      */
     template<typename Head, typename ...Tail>
-    decltype(auto) operator()(Head&& head, Tail&&...tail) const {
+    constexpr decltype(auto) operator()(Head&& head, Tail&&...tail) const {
         return static_cast<const TDerivedApplicative<Args...> *>(this)->internal_apply(std::forward<Head>(head))(std::forward<Tail>(tail)...);
     }
 };
@@ -0,0 +1,48 @@
+/**
+ * \brief       Debug-only assertions used by the unchecked accessors
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Assert Debug assertions
+ *
+ * Assertions are enabled when NDEBUG is not defined (same as the standard assert) or when
+ * YAFL_ENABLE_ASSERTS is defined. Defining YAFL_DISABLE_ASSERTS turns them off regardless.
+ * When disabled, YAFL_ASSERT expands to nothing, so unchecked accessors compile to a plain access.
+ */
+#pragma once
+
+#if !defined(YAFL_DISABLE_ASSERTS) && (defined(YAFL_ENABLE_ASSERTS) || !defined(NDEBUG))
+#define YAFL_ASSERTS_ENABLED 1
+#else
+#define YAFL_ASSERTS_ENABLED 0
+#endif
+
+#if YAFL_ASSERTS_ENABLED
+#include <cstdio>
+#include <cstdlib>
+
+namespace yafl {
+namespace details {
+
+/**
+ * @ingroup Assert
+ *
+ * Reports a failed assertion and aborts the program
+ * @param condition text of the failed condition
+ * @param message assertion message
+ * @param file source file of the assertion
+ * @param line source line of the assertion
+ */
+[[noreturn]] inline void assertFailed(const char* condition, const char* message, const char* file, int line) {
+    std::fprintf(stderr, "%s:%d: yafl assertion '%s' failed: %s\n", file, line, condition, message);
+    std::abort();
+}
+
+} // namespace details
+} // namespace yafl
+
+#define YAFL_ASSERT(condition, message) \
+    ((condition) ? static_cast<void>(0) : ::yafl::details::assertFailed(#condition, message, __FILE__, __LINE__))
+#else
+#define YAFL_ASSERT(condition, message) static_cast<void>(0)
+#endif
@@ -0,0 +1,157 @@
+/**
+ * \brief       Packed bitmaps used by the columnar containers
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Bitmap Packed bitmaps
+ *
+ * A bitmap of N bits is stored as ceil(N / 64) 64-bit words, bit i living in word i / 64.
+ * Bits past N in the last word are always zero, so whole words can be combined or counted
+ * without masking.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace yafl {
+namespace bitmap {
+
+/// Bitmap word type
+using Word = std::uint64_t;
+
+/// Number of bits in a bitmap word
+constexpr std::size_t WordBits = 64;
+
+/// Word with all bits set
+constexpr Word FullWord = ~Word{0};
+
+/**
+ * @ingroup Bitmap
+ *
+ * Number of words needed to store the given number of bits
+ * @param bits number of bits
+ * @return number of words
+ */
+constexpr std::size_t words(std::size_t bits) {
+    return (bits + WordBits - 1) / WordBits;
+}
+
+/**
+ * @ingroup Bitmap
+ *
+ * Checks whether bit at given index is set
+ * @param data bitmap words
+ * @param index bit index
+ * @return true if set and false otherwise
+ */
+constexpr bool test(const Word* data, std::size_t index) {
+    return (data[index / WordBits] >> (index % WordBits)) & Word{1};
+}
+
+/**
+ * @ingroup Bitmap
+ *
+ * Sets or clears the bit at given index
+ * @param data bitmap words
+ * @param index bit index
+ * @param value true to set and false to clear
+ */
+constexpr void assign(Word* data, std::size_t index, bool value) {
+    const Word mask = Word{1} << (index % WordBits);
+    data[index / WordBits] = value ? (data[index / WordBits] | mask) : (data[index / WordBits] & ~mask);
+}
+
+/**
+ * @ingroup Bitmap
+ *
+ * Index of the lowest set bit
+ * @param word word with at least one bit set
+ * @return index of the lowest set bit
+ */
+inline std::size_t lowestSetBit(Word word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return index;
+#else
+    std::size_t index = 0;
+    while (!(word & Word{1})) {
+        word >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @ingroup Bitmap
+ *
+ * Number of set bits in a word
+ * @param word word to count
+ * @return number of set bits
+ */
+inline std::size_t popcount(Word word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+    std::size_t total = 0;
+    for (; word; word &= word - 1) {
+        ++total;
+    }
+    return total;
+#endif
+}
+
+/**
+ * @ingroup Bitmap
+ *
+ * Number of set bits in the bitmap
+ * @param data bitmap words
+ * @param bits number of bits in the bitmap
+ * @return number of set bits
+ */
+inline std::size_t count(const Word* data, std::size_t bits) {
+    std::size_t total = 0;
+    for (std::size_t w = 0; w < words(bits); ++w) {
+        total += popcount(data[w]);
+    }
+    return total;
+}
+
+/**
+ * @ingroup Bitmap
+ *
+ * Calls given visitor with the index of every set bit, in increasing order.
+ * Full words are visited with a plain counted loop, without inspecting the bits,
+ * so dense bitmaps keep the visitor loop free of branches; empty words are skipped.
+ * @tparam Visitor callable type receiving a std::size_t index
+ * @param data bitmap words
+ * @param bits number of bits in the bitmap
+ * @param visitor callable to invoke for every set bit
+ */
+template <typename Visitor>
+void forEachSet(const Word* data, std::size_t bits, Visitor&& visitor) {
+    for (std::size_t w = 0; w < words(bits); ++w) {
+        Word word = data[w];
+        const std::size_t base = w * WordBits;
+        if (word == FullWord) {
+            for (std::size_t index = base; index < base + WordBits; ++index) {
+                visitor(index);
+            }
+        } else {
+            for (; word; word &= word - 1) {
+                visitor(base + lowestSetBit(word));
+            }
+        }
+    }
+}
+
+} // namespace bitmap
+} // namespace yafl
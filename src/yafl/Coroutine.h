@@ -0,0 +1,271 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Coroutine Coroutine do-notation
+ *
+ * C++20 coroutine support for Maybe and Either. A function returning Maybe<T> or Either<E, T> becomes a
+ * coroutine as soon as it uses co_await/co_return, which gives a do-notation on top of bind:
+ *
+ *     Maybe<int> sum(const Maybe<int>& a, int b) {
+ *         auto x = co_await a;                  // Nothing short-circuits the whole function
+ *         auto y = co_await safeDivide(x, b);   // Either<E, int> error also short-circuits
+ *         co_return x + y;
+ *     }
+ *
+ * Every coroutine runs eagerly to completion inside the call, so awaiting a Nothing/Error stores the failure
+ * in the caller's result and destroys the coroutine frame right away. The frame never outlives the call, which
+ * lets the compiler elide its heap allocation when the coroutine is inlined into the caller (e.g, Clang -O2),
+ * otherwise it is a single operator new/delete pair per call.
+ *
+ * This header requires C++20 and is opt-in: configure with -DYAFL_ENABLE_COROUTINES=ON (or compile with
+ * -std=c++20) and include it explicitly.
+ */
+#pragma once
+
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "yafl/Coroutine.h requires C++20 coroutines, configure Yafl with YAFL_ENABLE_COROUTINES"
+#endif
+
+#include <coroutine>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "yafl/Assert.h"
+#include "yafl/Either.h"
+#include "yafl/Maybe.h"
+#include "yafl/TypeTraits.h"
+
+namespace yafl {
+namespace coroutine {
+namespace details {
+
+/**
+ * @ingroup Coroutine
+ *
+ * Checks whether T is a Maybe
+ * @tparam T type to check
+ */
+template <typename T>
+struct IsMaybe : std::false_type {};
+
+template <typename T>
+struct IsMaybe<Maybe<T>> : std::true_type {};
+
+/**
+ * @ingroup Coroutine
+ *
+ * Checks whether T is an Either
+ * @tparam T type to check
+ */
+template <typename T>
+struct IsEither : std::false_type {};
+
+template <typename E, typename T>
+struct IsEither<Either<E, T>> : std::true_type {};
+
+/**
+ * @ingroup Coroutine
+ *
+ * Object returned by the coroutine ramp. It owns the storage where the coroutine writes its result and is
+ * converted to the declared Maybe/Either once the coroutine completed.
+ * @tparam Result Maybe or Either returned by the coroutine
+ */
+template <typename Result>
+class ReturnObject {
+public:
+    /**
+     * Binds the storage to the promise. The object is initialized in place by the coroutine ramp, hence it
+     * can be neither copied nor moved
+     * @param slot promise pointer to the storage
+     */
+    explicit ReturnObject(std::optional<Result>*& slot) noexcept {
+        slot = &_result;
+    }
+
+    ReturnObject(const ReturnObject&) = delete;
+    ReturnObject(ReturnObject&&) = delete;
+    ReturnObject& operator=(const ReturnObject&) = delete;
+    ReturnObject& operator=(ReturnObject&&) = delete;
+
+    /**
+     * Extracts the result of the coroutine
+     * @return Maybe/Either produced by the coroutine
+     */
+    operator Result() {
+        YAFL_ASSERT(_result.has_value(), "coroutine did not complete before returning");
+        return std::move(*_result);
+    }
+
+private:
+    std::optional<Result> _result;
+};
+
+/**
+ * @ingroup Coroutine
+ *
+ * Awaiter of a Maybe/Either inside a Maybe/Either coroutine. On failure the error is forwarded to the
+ * coroutine result and the frame is destroyed, on success the value is handed to the coroutine body.
+ * @tparam Awaited reference to the awaited Maybe/Either
+ */
+template <typename Awaited>
+class Awaiter {
+public:
+    explicit Awaiter(Awaited awaited) noexcept : _awaited(std::forward<Awaited>(awaited)) {}
+
+    [[nodiscard]] bool await_ready() const noexcept {
+        if constexpr (IsMaybe<std::decay_t<Awaited>>::value) {
+            return _awaited.hasValue();
+        } else {
+            return _awaited.isOk();
+        }
+    }
+
+    template <typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) {
+        handle.promise().fail(std::forward<Awaited>(_awaited));
+        handle.destroy();
+    }
+
+    decltype(auto) await_resume() {
+        using ValueType = typename type::DomainTypeInfo<Awaited>::ValueType;
+        if constexpr (std::is_void_v<ValueType>) {
+            return;
+        } else if constexpr (std::is_lvalue_reference_v<Awaited>) {
+            return *_awaited;
+        } else {
+            return ValueType(*std::move(_awaited));
+        }
+    }
+
+private:
+    Awaited _awaited;
+};
+
+/**
+ * @ingroup Coroutine
+ *
+ * Promise behaviour shared by Maybe and Either coroutines
+ * @tparam Result Maybe or Either returned by the coroutine
+ */
+template <typename Result>
+class PromiseBase {
+public:
+    PromiseBase() = default;
+    PromiseBase(const PromiseBase&) = delete;
+    PromiseBase& operator=(const PromiseBase&) = delete;
+
+    ReturnObject<Result> get_return_object() noexcept { return ReturnObject<Result>{_result}; }
+
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+
+    std::suspend_never final_suspend() const noexcept { return {}; }
+
+    /**
+     * Exceptions escape to the caller, the ramp destroys the frame since the coroutine never suspended
+     */
+    [[noreturn]] void unhandled_exception() {
+        throw;
+    }
+
+    /**
+     * Only Maybe and Either can be awaited, any other awaitable would suspend a coroutine nobody resumes
+     * @param awaited Maybe/Either to await
+     * @return awaiter
+     */
+    template <typename Awaited>
+    Awaiter<Awaited&&> await_transform(Awaited&& awaited) noexcept {
+        static_assert(IsMaybe<std::decay_t<Awaited>>::value || IsEither<std::decay_t<Awaited>>::value,
+                      "Only Maybe and Either can be awaited inside a Maybe/Either coroutine");
+        return Awaiter<Awaited&&>{std::forward<Awaited>(awaited)};
+    }
+
+    /**
+     * Stores the failure of an awaited Maybe/Either as the coroutine result
+     * @param awaited failed Maybe/Either
+     */
+    template <typename Awaited>
+    void fail(Awaited&& awaited) {
+        using AwaitedType = std::decay_t<Awaited>;
+        if constexpr (IsMaybe<Result>::value) {
+            set(Result::Nothing());
+        } else {
+            static_assert(IsEither<AwaitedType>::value, "Awaiting a Maybe requires a Maybe coroutine, Nothing carries no error");
+            using ErrorType = typename type::DomainTypeInfo<Result>::ErrorType;
+            using AwaitedError = typename type::DomainTypeInfo<AwaitedType>::ErrorType;
+            if constexpr (std::is_void_v<ErrorType>) {
+                set(Result::Error());
+            } else {
+                static_assert(std::is_convertible_v<AwaitedError, ErrorType>, "Awaited error type not convertible to the coroutine error type");
+                set(Result::Error(std::forward<Awaited>(awaited).error()));
+            }
+        }
+    }
+
+protected:
+    void set(Result&& result) {
+        _result->emplace(std::move(result));
+    }
+
+private:
+    std::optional<Result>* _result = nullptr;
+};
+
+/**
+ * @ingroup Coroutine
+ *
+ * Promise of Maybe/Either coroutines producing a value. co_return accepts either a value, which is wrapped,
+ * or a complete Maybe/Either, e.g, co_return Either<E, T>::Error(e)
+ * @tparam Result Maybe or Either returned by the coroutine
+ */
+template <typename Result, typename Value = typename type::DomainTypeInfo<Result>::ValueType>
+class Promise : public PromiseBase<Result> {
+public:
+    template <typename U = Value>
+    void return_value(U&& value) {
+        if constexpr (std::is_same_v<std::decay_t<U>, Result>) {
+            this->set(Result(std::forward<U>(value)));
+        } else {
+            this->set(type::DomainTypeInfo<Result>::wrapValue(Value(std::forward<U>(value))));
+        }
+    }
+};
+
+/**
+ * @ingroup Coroutine
+ *
+ * Promise of Maybe<void>/Either<E, void> coroutines, co_return; yields Just()/Ok()
+ * @tparam Result Maybe or Either returned by the coroutine
+ */
+template <typename Result>
+class Promise<Result, void> : public PromiseBase<Result> {
+public:
+    void return_void() {
+        if constexpr (IsMaybe<Result>::value) {
+            this->set(Result::Just());
+        } else {
+            this->set(Result::Ok());
+        }
+    }
+};
+
+} // namespace details
+} // namespace coroutine
+} // namespace yafl
+
+/**
+ * Makes every function returning Maybe<T> a coroutine candidate
+ */
+template <typename T, typename ...Args>
+struct std::coroutine_traits<yafl::Maybe<T>, Args...> {
+    using promise_type = yafl::coroutine::details::Promise<yafl::Maybe<T>>;
+};
+
+/**
+ * Makes every function returning Either<E, T> a coroutine candidate
+ */
+template <typename E, typename T, typename ...Args>
+struct std::coroutine_traits<yafl::Either<E, T>, Args...> {
+    using promise_type = yafl::coroutine::details::Promise<yafl::Either<E, T>>;
+};
@@ -7,14 +7,21 @@
  */
 #pragma once
 
-#include <iostream>
-#include <memory>
+#include <cstddef>
 #include <functional>
-#include <variant>
+#include <memory>
 #include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include "yafl/fwd.h"
 #include "yafl/Functor.h"
 #include "yafl/Monad.h"
 #include "yafl/Applicative.h"
+#include "yafl/Assert.h"
 
 namespace yafl {
 
@@ -67,6 +74,13 @@ struct DomainDetailsImpl<Either < InnerError, InnerValue>> {
             return DerivedType::Error(args.error()...);
         }
     };
+    ///Callback responsible for wrapping a value into the Derived type
+    static constexpr auto wrapValue = [](auto&& value) {
+        return DerivedType::Ok(std::forward<decltype(value)>(value));
+    };
+    /// Same monad holding another value type
+    template<typename T>
+    using RebindType = Either<InnerError, T>;
 };
 } // namespace details
 
@@ -82,8 +96,87 @@ struct PinErrorType {
     template <typename ValueType>
     using Type = Either<ErrorType, ValueType>;
 };
+
+/**
+ * @ingroup Either
+ *
+ * Customization point that declares a spare bit pattern (niche) of type T, i.e, a value
+ * that is never used as a valid T. Either<void, T> and Either<T, void> use the niche to
+ * represent the missing alternative, so they have the same size as T instead of paying
+ * for an extra flag. The niche value itself therefore cannot be stored: Ok(niche) would
+ * read back as an Error, which is asserted in debug builds. Types have no niche by default. To declare one, specialize this struct
+ * with hasNiche set to true and provide the spare value, e.g, for an enum with unused values:
+ * \code
+ * template<> struct yafl::type::Niche<Color> {
+ *     static constexpr bool hasNiche = true;
+ *     static constexpr Color value = static_cast<Color>(0xFF);
+ * };
+ * \endcode
+ * @tparam T type to declare the niche for
+ */
+template <typename T>
+struct Niche {
+    ///boolean flag that states whether type T has a spare value or not
+    static constexpr bool hasNiche = false;
+};
 } // namespace type
 
+namespace either {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * Optional like storage that uses the niche declared in type::Niche<T> to represent
+ * the empty state. Provides the subset of the std::optional interface used by Either.
+ * @tparam T stored type
+ */
+template <typename T>
+class NicheStorage {
+public:
+    constexpr NicheStorage() : _value{type::Niche<T>::value} {}
+
+    template <typename ...Args>
+    constexpr explicit NicheStorage(std::in_place_t, Args&& ...args) : _value(std::forward<Args>(args)...) {
+        YAFL_ASSERT(has_value(), "the niche value cannot be stored, it represents the missing alternative");
+    }
+
+    constexpr bool operator==(const NicheStorage<T>& other) const {
+        return _value == other._value;
+    }
+
+    [[nodiscard]] constexpr bool has_value() const { return !(_value == type::Niche<T>::value); }
+
+    constexpr const T& value() const& { return _value; }
+
+    constexpr T&& value() && { return std::move(_value); }
+
+    constexpr const T& operator*() const& { return _value; }
+
+    constexpr T& operator*() & { return _value; }
+
+    constexpr T&& operator*() && { return std::move(_value); }
+
+    constexpr const T* operator->() const { return std::addressof(_value); }
+
+    constexpr T* operator->() { return std::addressof(_value); }
+
+private:
+    T _value;
+};
+
+/**
+ * @ingroup Details
+ *
+ * Storage used for the single alternative of Either<void, T> and Either<T, void>
+ * @tparam T stored type
+ */
+template <typename T>
+using OptionalStorage = std::conditional_t<type::Niche<T>::hasNiche, NicheStorage<T>, std::optional<T>>;
+
+} // namespace details
+} // namespace either
+
 /**
  * @ingroup Either
  *
@@ -96,7 +189,7 @@ class Either<void, void> : public core::Functor<Either, void, void>
     friend class core::Monad<Either, void, void>;
 
 private:
-    explicit Either(bool v) : _value(v) {}
+    constexpr explicit Either(bool v) : _value(v) {}
 
 public:
     /**
@@ -130,7 +223,7 @@ public:
      * @param other instance of either to compare to
      * @return true if objects are equal and false otherwise
      */
-    bool operator==(const Either<void, void>& other) const noexcept {
+    constexpr bool operator==(const Either<void, void>& other) const noexcept {
         return _value == other._value;
     }
 
@@ -138,7 +231,7 @@ public:
      * Logical not operator
      * @return false if either has value and true otherwise
      */
-    bool operator!() const {
+    constexpr bool operator!() const {
         return !_value;
     }
 
@@ -146,7 +239,7 @@ public:
      * Constructs an Either type that is an Error
      * @return Either with error defined
      */
-    static Either<void, void> Error() {
+    static constexpr Either<void, void> Error() {
         return Either<void, void>(false);
     }
 
@@ -154,7 +247,7 @@ public:
      * Constructs an Either type that is an Ok
      * @return Either with value defined
      */
-    static Either<void, void> Ok() {
+    static constexpr Either<void, void> Ok() {
         return Either<void, void>{true};
     }
 
@@ -162,39 +255,39 @@ public:
      * Returns whether Either is an Error or a Value
      * @return true if error and false otherwise
      */
-    [[nodiscard]] bool isError() const { return !_value; }
+    [[nodiscard]] constexpr bool isError() const { return !_value; }
 
     /**
      * Returns whether Either is an Error or a Value
      * @return true if value and false otherwise
      */
-    [[nodiscard]] bool isOk() const { return _value; }
+    [[nodiscard]] constexpr bool isOk() const { return _value; }
 
 private:
     template <typename Callable>
-    decltype(auto) internal_bind(Callable&& callable) const {
+    constexpr decltype(auto) internal_bind(Callable&& callable) const {
         static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
         using InnerTypeError = typename type::DomainTypeInfo<ReturnType>::ErrorType;
         static_assert(std::is_same_v<void, InnerTypeError>, "Error type does not match");
         using InnerTypeOK = typename type::DomainTypeInfo<ReturnType>::ValueType;
         if (isOk()) {
-            return std::invoke<Callable>(std::forward<Callable>(callable));
+            return function::invoke(std::forward<Callable>(callable));
         } else {
             return Either<InnerTypeError, InnerTypeOK>::Error();
         }
     }
 
     template <typename Callable>
-    decltype(auto) internal_fmap(Callable&& callable) const {
+    constexpr decltype(auto) internal_fmap(Callable&& callable) const {
         static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
         if (isOk()) {
             if constexpr (std::is_void_v<ReturnType>) {
-                std::invoke<Callable>(std::forward<Callable>(callable));
+                function::invoke(std::forward<Callable>(callable));
                 return Either<void, ReturnType>::Ok();
             } else {
-                return Either<void, ReturnType>::Ok(std::invoke<Callable>(std::forward<Callable>(callable)));
+                return Either<void, ReturnType>::Ok(function::invoke(std::forward<Callable>(callable)));
             }
         } else {
             return Either<void, ReturnType>::Error();
@@ -219,8 +312,12 @@ class Either<void, ValueType> : public core::Functor<Either, void, ValueType>
     friend class core::Monad<Either, void, ValueType>;
 
 private:
-    Either() : _value{}{}
-    explicit Either(const ValueType& value) : _value{value}{}
+    constexpr Either() : _value{}{}
+    constexpr explicit Either(const ValueType& value) : _value{std::in_place, value}{}
+    constexpr explicit Either(ValueType&& value) : _value{std::in_place, std::move(value)}{}
+
+    template <typename ...Args>
+    constexpr explicit Either(std::in_place_t, Args&& ...args) : _value{std::in_place, std::forward<Args>(args)...}{}
 
 public:
     /**
@@ -254,7 +351,7 @@ public:
      * @param other instance of either to compare to
      * @return true if objects are equal and false otherwise
      */
-    bool operator==(const Either<void, ValueType>& other) const noexcept {
+    constexpr bool operator==(const Either<void, ValueType>& other) const noexcept {
         return _value == other._value;
     }
 
@@ -262,7 +359,7 @@ public:
      * Logical not operator
      * @return false if either has value and true otherwise
      */
-    bool operator!() const {
+    constexpr bool operator!() const {
         return !_value.has_value();
     }
 
@@ -270,7 +367,7 @@ public:
      * Constructs an Either type that is an Error
      * @return Either with error defined
      */
-    static Either<void, ValueType> Error() {
+    static constexpr Either<void, ValueType> Error() {
         return Either<void, ValueType>();
     }
 
@@ -279,67 +376,196 @@ public:
      * @param value to be wrapped in the Either
      * @return Either with value defined
      */
-    static Either<void, ValueType> Ok(const ValueType& value) {
+    static constexpr Either<void, ValueType> Ok(const ValueType& value) {
         return Either<void, ValueType>(value);
     }
 
+    /**
+     * Constructs an Either type that is a Value
+     * @param value to be moved into the Either
+     * @return Either with value defined
+     */
+    static constexpr Either<void, ValueType> Ok(ValueType&& value) {
+        return Either<void, ValueType>(std::move(value));
+    }
+
+    /**
+     * Constructs an Either type that is a Value
+     * @param args arguments forwarded to the constructor of the value
+     * @return Either with value constructed in place
+     */
+    template <typename ...Args>
+    static constexpr Either<void, ValueType> Ok(std::in_place_t, Args&& ...args) {
+        return Either<void, ValueType>(std::in_place, std::forward<Args>(args)...);
+    }
+
     /**
      * Returns whether Either is an Error or a Value
      * @return true if error and false otherwise
      */
-    [[nodiscard]] bool isError() const { return !_value.has_value(); }
+    [[nodiscard]] constexpr bool isError() const { return !_value.has_value(); }
 
     /**
      * Returns whether Either is an Error or a Value
      * @return true if value and false otherwise
      */
-    [[nodiscard]] bool isOk() const { return _value.has_value(); }
+    [[nodiscard]] constexpr bool isOk() const { return _value.has_value(); }
 
     /**
      * Extracts the wrapped value from the Either
      * @return the value wrapped
      * @throws std::runtime_error when either contains error
      */
-    [[nodiscard]] ValueType value() const {
+    [[nodiscard]] constexpr ValueType value() const& {
         if (isOk()) return _value.value();
         throw std::runtime_error("ValueType not defined");
     }
 
+    /**
+     * Extracts the wrapped value from the Either by moving it out
+     * @return the value wrapped
+     * @throws std::runtime_error when either contains error
+     */
+    [[nodiscard]] constexpr ValueType value() && {
+        if (isOk()) return std::move(_value).value();
+        throw std::runtime_error("ValueType not defined");
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return const reference to the wrapped value
+     */
+    [[nodiscard]] constexpr const ValueType& value_ref() const& {
+        YAFL_ASSERT(isOk(), "value_ref() called without value");
+        return *_value;
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return reference to the wrapped value
+     */
+    constexpr const ValueType& operator*() const& {
+        YAFL_ASSERT(isOk(), "operator*() called without value");
+        return *_value;
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return reference to the wrapped value
+     */
+    constexpr ValueType& operator*() & {
+        YAFL_ASSERT(isOk(), "operator*() called without value");
+        return *_value;
+    }
+
+    /**
+     * Unchecked access to the wrapped value that allows moving it out.
+     * The value must exist, which is only asserted in debug builds
+     * @return rvalue reference to the wrapped value
+     */
+    constexpr ValueType&& operator*() && {
+        YAFL_ASSERT(isOk(), "operator*() called without value");
+        return std::move(*_value);
+    }
+
+    /**
+     * Unchecked member access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return pointer to the wrapped value
+     */
+    constexpr const ValueType* operator->() const {
+        YAFL_ASSERT(isOk(), "operator->() called without value");
+        return _value.operator->();
+    }
+
+    /**
+     * Unchecked member access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return pointer to the wrapped value
+     */
+    constexpr ValueType* operator->() {
+        YAFL_ASSERT(isOk(), "operator->() called without value");
+        return _value.operator->();
+    }
+
     /**
      * Extracts the wrapped value from the Either if exists or returns
      * te provided default value if either contains error
      * @param defaultValue Default value
      * @return the value wrapped or default
      */
-    [[nodiscard]] ValueType valueOr(const ValueType& defaultValue) const {
-        return (isOk()) ? value() : defaultValue;
+    [[nodiscard]] constexpr ValueType valueOr(const ValueType& defaultValue) const& {
+        return (isOk()) ? _value.value() : defaultValue;
+    }
+
+    /**
+     * Extracts the wrapped value from the Either by moving it out if exists or
+     * returns the provided default value if either contains error
+     * @param defaultValue Default value
+     * @return the value wrapped or default
+     */
+    [[nodiscard]] constexpr ValueType valueOr(ValueType defaultValue) && {
+        return (isOk()) ? std::move(_value).value() : std::move(defaultValue);
     }
 
 private:
     template <typename Callable>
-    decltype(auto) internal_bind(Callable&& callable) const {
+    constexpr decltype(auto) internal_bind(Callable&& callable) const& {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<ValueType>>, "Input argument is not invocable");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<ValueType>>>;
+        using InnerTypeError = typename type::DomainTypeInfo<ReturnType>::ErrorType;
+        static_assert(std::is_same_v<void, InnerTypeError>, "Error type does not match");
+        using InnerTypeOK = typename type::DomainTypeInfo<ReturnType>::ValueType;
+        if (isOk()) {
+            return function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(_value.value()));
+        } else {
+            return Either<InnerTypeError, InnerTypeOK>::Error();
+        }
+    }
+
+    template <typename Callable>
+    constexpr decltype(auto) internal_bind(Callable&& callable) && {
         static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<ValueType>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<ValueType>>>;
         using InnerTypeError = typename type::DomainTypeInfo<ReturnType>::ErrorType;
         static_assert(std::is_same_v<void, InnerTypeError>, "Error type does not match");
         using InnerTypeOK = typename type::DomainTypeInfo<ReturnType>::ValueType;
         if (isOk()) {
-            return std::invoke<Callable>(std::forward<Callable>(callable), value());
+            return function::invoke(std::forward<Callable>(callable), std::move(*this).value());
         } else {
             return Either<InnerTypeError, InnerTypeOK>::Error();
         }
     }
 
     template <typename Callable>
-    decltype(auto) internal_fmap(Callable&& callable) const {
+    constexpr decltype(auto) internal_fmap(Callable&& callable) const& {
         static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<ValueType>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<ValueType>>>;
         if (isOk()) {
             if constexpr (std::is_void_v<ReturnType>) {
-                std::invoke<Callable>(std::forward<Callable>(callable), value());
+                function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(_value.value()));
                 return Either<void, ReturnType>::Ok();
             } else {
-                return Either<void, ReturnType>::Ok(std::invoke<Callable>(std::forward<Callable>(callable), value()));
+                return Either<void, ReturnType>::Ok(function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(_value.value())));
+            }
+        } else {
+            return Either<void, ReturnType>::Error();
+        }
+    }
+
+    template <typename Callable>
+    constexpr decltype(auto) internal_fmap(Callable&& callable) && {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<ValueType>>, "Input argument is not invocable");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<ValueType>>>;
+        if (isOk()) {
+            if constexpr (std::is_void_v<ReturnType>) {
+                function::invoke(std::forward<Callable>(callable), std::move(*this).value());
+                return Either<void, ReturnType>::Ok();
+            } else {
+                return Either<void, ReturnType>::Ok(function::invoke(std::forward<Callable>(callable), std::move(*this).value()));
             }
         } else {
             return Either<void, ReturnType>::Error();
@@ -347,7 +573,7 @@ private:
     }
 
     template<typename Arg>
-    decltype(auto) internal_apply(Arg&& arg) const {
+    constexpr decltype(auto) internal_apply(Arg&& arg) const {
         static_assert(!std::is_invocable_v<std::decay_t<ValueType>>, "Function that takes 0 arguments cannot be called with arguments");
         if constexpr (type::DomainTypeInfo<Arg>::hasMonadicBase) {
             if (arg.isOk()) {
@@ -368,7 +594,7 @@ private:
     }
 
     template<typename Arg>
-    decltype(auto) internal_apply_non_monad(Arg&& arg) const {
+    constexpr decltype(auto) internal_apply_non_monad(Arg&& arg) const {
         static_assert(!std::is_invocable_v<std::decay_t<ValueType>>, "Function that takes 0 arguments cannot be called with arguments");
 
         if constexpr (std::is_invocable_v<std::decay_t<ValueType>, std::decay_t<Arg>>) {
@@ -388,33 +614,34 @@ private:
 
             if (isOk()) {
                 return Either<void, PartialFunctionType>::Ok(
-                        [callable = value(), first = std::forward<Arg>(arg)](auto&& ...args) mutable {
-                            return callable(std::move(first), std::forward<decltype(args)>(args)...);
-                        });
+                        function::BoundCall<std::decay_t<ValueType>, typename function::Info<ValueType>::DeclaredArgTypes, std::decay_t<Arg>>(
+                                value(), std::forward<Arg>(arg)));
                 } else {
                     return Either<void, PartialFunctionType>::Error();
                 }
             }
         }
 
-    decltype(auto) internal_apply() const {
-        static_assert(std::is_invocable_v<std::decay_t<ValueType>>, "Function that takes one or more arguments cannot be called without arguments");
+    // member template, so that explicit instantiations of Either<E, V> with a non callable V skip it
+    template <typename Callable = ValueType>
+    constexpr decltype(auto) internal_apply() const {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Function that takes one or more arguments cannot be called without arguments");
 
-        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<ValueType>>>;
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
         if (isError()) {
             return Either<void, ReturnType>::Error();
         } else {
             if constexpr (std::is_void_v<ReturnType>) {
-                std::invoke<ValueType>(value());
+                std::invoke<Callable>(value());
                 return Either<void, ReturnType>::Ok();
             } else {
-                return Either<void, ReturnType>::Ok(std::invoke<ValueType>(value()));
+                return Either<void, ReturnType>::Ok(std::invoke<Callable>(value()));
             }
         }
     }
 
 private:
-    std::optional<ValueType> _value;
+    either::details::OptionalStorage<ValueType> _value;
 };
 
 /**
@@ -429,8 +656,12 @@ class Either<ErrorType, void> : public core::Functor<Either, ErrorType, void>
     friend class core::Monad<Either, ErrorType, void>;
 
 private:
-    Either() : _error{}{}
-    explicit Either(const ErrorType& error) : _error{error}{}
+    constexpr Either() : _error{}{}
+    constexpr explicit Either(const ErrorType& error) : _error{std::in_place, error}{}
+    constexpr explicit Either(ErrorType&& error) : _error{std::in_place, std::move(error)}{}
+
+    template <typename ...Args>
+    constexpr explicit Either(std::in_place_t, Args&& ...args) : _error{std::in_place, std::forward<Args>(args)...}{}
 
 public:
     /**
@@ -464,7 +695,7 @@ public:
      * @param other instance of either to compare to
      * @return true if objects are equal and false otherwise
      */
-    bool operator==(const Either<ErrorType, void>& other) const noexcept {
+    constexpr bool operator==(const Either<ErrorType, void>& other) const noexcept {
         return _error == other._error;
     }
 
@@ -472,7 +703,7 @@ public:
      * Logical not operator
      * @return true if either has error and false otherwise
      */
-    bool operator!() const {
+    constexpr bool operator!() const {
         return _error.has_value();
     }
 
@@ -480,7 +711,7 @@ public:
      * Constructs an Either type that is an Ok
      * @return Either with value defined
      */
-    static Either<ErrorType, void> Ok() {
+    static constexpr Either<ErrorType, void> Ok() {
         return Either<ErrorType, void>();
     }
 
@@ -489,75 +720,154 @@ public:
      * @param error to be wrapped as error
      * @return Either with error defined
      */
-    static Either<ErrorType, void> Error(const ErrorType& error) {
+    static constexpr Either<ErrorType, void> Error(const ErrorType& error) {
         return Either<ErrorType, void>(error);
     }
 
+    /**
+     * Constructs an Either type that is an Error
+     * @param error to be moved into the Either as error
+     * @return Either with error defined
+     */
+    static constexpr Either<ErrorType, void> Error(ErrorType&& error) {
+        return Either<ErrorType, void>(std::move(error));
+    }
+
+    /**
+     * Constructs an Either type that is an Error
+     * @param args arguments forwarded to the constructor of the error
+     * @return Either with error constructed in place
+     */
+    template <typename ...Args>
+    static constexpr Either<ErrorType, void> Error(std::in_place_t, Args&& ...args) {
+        return Either<ErrorType, void>(std::in_place, std::forward<Args>(args)...);
+    }
+
     /**
      * Returns whether Either is an Error or a Value
      * @return true if error and false otherwise
      */
-    [[nodiscard]] bool isError() const { return _error.has_value(); }
+    [[nodiscard]] constexpr bool isError() const { return _error.has_value(); }
 
     /**
      * Returns whether Either is an Error or a Value
      * @return true if value and false otherwise
      */
-    [[nodiscard]] bool isOk() const { return !_error.has_value(); }
+    [[nodiscard]] constexpr bool isOk() const { return !_error.has_value(); }
 
     /**
      * Extracts the wrapped error from the Either
      * @return the error wrapped
      * @throws std::runtime_error when either contains value
      */
-    [[nodiscard]] ErrorType error() const {
+    [[nodiscard]] constexpr ErrorType error() const& {
         if (isError()) return _error.value();
         throw std::runtime_error("Error not defined");
     }
 
+    /**
+     * Extracts the wrapped error from the Either by moving it out
+     * @return the error wrapped
+     * @throws std::runtime_error when either contains value
+     */
+    [[nodiscard]] constexpr ErrorType error() && {
+        if (isError()) return std::move(_error).value();
+        throw std::runtime_error("Error not defined");
+    }
+
+    /**
+     * Unchecked access to the wrapped error. The error must exist, which is
+     * only asserted in debug builds
+     * @return const reference to the wrapped error
+     */
+    [[nodiscard]] constexpr const ErrorType& error_ref() const& {
+        YAFL_ASSERT(isError(), "error_ref() called without error");
+        return *_error;
+    }
+
     /**
      * Extracts the wrapped error from the Either if exists
      * otherwise return the provided default error
      * @param defaultError Default error
      * @return the error wrapped
      */
-    [[nodiscard]] ErrorType errorOr(const ErrorType& defaultError) const {
+    [[nodiscard]] constexpr ErrorType errorOr(const ErrorType& defaultError) const& {
         return isError() ? _error.value() : defaultError;
     }
 
+    /**
+     * Extracts the wrapped error from the Either by moving it out if exists
+     * otherwise return the provided default error
+     * @param defaultError Default error
+     * @return the error wrapped
+     */
+    [[nodiscard]] constexpr ErrorType errorOr(ErrorType defaultError) && {
+        return isError() ? std::move(_error).value() : std::move(defaultError);
+    }
+
 private:
     template <typename Callable>
-    decltype(auto) internal_bind(Callable&& callable) const {
+    constexpr decltype(auto) internal_bind(Callable&& callable) const& {
         static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
         using InnerTypeError = typename type::DomainTypeInfo<ReturnType>::ErrorType;
         static_assert(std::is_same_v<ErrorType, InnerTypeError>, "Error type does not match");
         using InnerTypeOK = typename type::DomainTypeInfo<ReturnType>::ValueType;
         if (isOk()) {
-            return std::invoke<Callable>(std::forward<Callable>(callable));
+            return function::invoke(std::forward<Callable>(callable));
         } else {
-            return Either<ErrorType, InnerTypeOK>::Error(error());
+            return Either<ErrorType, InnerTypeOK>::Error(_error.value());
         }
     }
 
     template <typename Callable>
-    decltype(auto) internal_fmap(Callable&& callable) const {
+    constexpr decltype(auto) internal_bind(Callable&& callable) && {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Input argument is not invocable");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
+        using InnerTypeError = typename type::DomainTypeInfo<ReturnType>::ErrorType;
+        static_assert(std::is_same_v<ErrorType, InnerTypeError>, "Error type does not match");
+        using InnerTypeOK = typename type::DomainTypeInfo<ReturnType>::ValueType;
+        if (isOk()) {
+            return function::invoke(std::forward<Callable>(callable));
+        } else {
+            return Either<ErrorType, InnerTypeOK>::Error(std::move(*this).error());
+        }
+    }
+
+    template <typename Callable>
+    constexpr decltype(auto) internal_fmap(Callable&& callable) const& {
         static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
         if (isOk()) {
             if constexpr (std::is_void_v<ReturnType>) {
-                std::invoke<Callable>(std::forward<Callable>(callable));
+                function::invoke(std::forward<Callable>(callable));
                 return Either<ErrorType, ReturnType>::Ok();
             } else {
-                return Either<ErrorType, ReturnType>::Ok(std::invoke<Callable>(std::forward<Callable>(callable)));
+                return Either<ErrorType, ReturnType>::Ok(function::invoke(std::forward<Callable>(callable)));
             }
         } else {
-            return Either<ErrorType, ReturnType>::Error(error());
+            return Either<ErrorType, ReturnType>::Error(_error.value());
+        }
+    }
+
+    template <typename Callable>
+    constexpr decltype(auto) internal_fmap(Callable&& callable) && {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Input argument is not invocable");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
+        if (isOk()) {
+            if constexpr (std::is_void_v<ReturnType>) {
+                function::invoke(std::forward<Callable>(callable));
+                return Either<ErrorType, ReturnType>::Ok();
+            } else {
+                return Either<ErrorType, ReturnType>::Ok(function::invoke(std::forward<Callable>(callable)));
+            }
+        } else {
+            return Either<ErrorType, ReturnType>::Error(std::move(*this).error());
         }
     }
 
 private:
-    std::optional<ErrorType> _error;
+    either::details::OptionalStorage<ErrorType> _error;
 };
 
 /**
@@ -579,7 +889,8 @@ private:
         EitherValue = 1
     };
 
-    explicit Either(Type type): _type{type}{}
+    template <std::size_t Index, typename ...Args>
+    constexpr explicit Either(std::in_place_index_t<Index> index, Args&& ...args) : _value{index, std::forward<Args>(args)...}{}
 
 public:
     /**
@@ -613,22 +924,16 @@ public:
      * @param other instance of either to compare to
      * @return true if objects are equal and false otherwise
      */
-    bool operator==(const Either<ErrorType, ValueType>& other) const {
-        if (isOk() && other.isOk()) {
-            return value() == other.value();
-        } else if (isError() && other.isError()) {
-            return error() == other.error();
-        } else {
-            return false;
-        }
+    constexpr bool operator==(const Either<ErrorType, ValueType>& other) const {
+        return _value == other._value;
     }
 
     /**
      * Logical not operator
      * @return false if either has value and true otherwise
      */
-    bool operator!() const {
-        return (_type == Type::EitherValue) ? false : true;
+    constexpr bool operator!() const {
+        return !isOk();
     }
 
     /**
@@ -636,10 +941,27 @@ public:
      * @param value to be wrapped as error
      * @return Either with error defined
      */
-    static Either<ErrorType, ValueType> Error(const ErrorType& value) {
-        Either<ErrorType, ValueType> result{Type::EitherError};
-        result._value.template emplace<Type::EitherError>(value);
-        return result;
+    static constexpr Either<ErrorType, ValueType> Error(const ErrorType& value) {
+        return Either<ErrorType, ValueType>{std::in_place_index<Type::EitherError>, value};
+    }
+
+    /**
+     * Constructs an Either type that is an Error
+     * @param value to be moved into the Either as error
+     * @return Either with error defined
+     */
+    static constexpr Either<ErrorType, ValueType> Error(ErrorType&& value) {
+        return Either<ErrorType, ValueType>{std::in_place_index<Type::EitherError>, std::move(value)};
+    }
+
+    /**
+     * Constructs an Either type that is an Error
+     * @param args arguments forwarded to the constructor of the error
+     * @return Either with error constructed in place
+     */
+    template <typename ...Args>
+    static constexpr Either<ErrorType, ValueType> Error(std::in_place_t, Args&& ...args) {
+        return Either<ErrorType, ValueType>{std::in_place_index<Type::EitherError>, std::forward<Args>(args)...};
     }
 
     /**
@@ -647,97 +969,254 @@ public:
      * @param value to be wrapped in the Either
      * @return Either with value defined
      */
-    static Either<ErrorType,ValueType> Ok(const ValueType& value) {
-        Either<ErrorType, ValueType> result{Type::EitherValue};
-        result._value.template emplace<Type::EitherValue>(value);
-        return result;
+    static constexpr Either<ErrorType,ValueType> Ok(const ValueType& value) {
+        return Either<ErrorType, ValueType>{std::in_place_index<Type::EitherValue>, value};
+    }
+
+    /**
+     * Constructs an Either type that is a Value
+     * @param value to be moved into the Either
+     * @return Either with value defined
+     */
+    static constexpr Either<ErrorType,ValueType> Ok(ValueType&& value) {
+        return Either<ErrorType, ValueType>{std::in_place_index<Type::EitherValue>, std::move(value)};
+    }
+
+    /**
+     * Constructs an Either type that is a Value
+     * @param args arguments forwarded to the constructor of the value
+     * @return Either with value constructed in place
+     */
+    template <typename ...Args>
+    static constexpr Either<ErrorType, ValueType> Ok(std::in_place_t, Args&& ...args) {
+        return Either<ErrorType, ValueType>{std::in_place_index<Type::EitherValue>, std::forward<Args>(args)...};
     }
 
     /**
      * Returns whether Either is an Error or a Value
      * @return true if error and false otherwise
      */
-    [[nodiscard]] bool isError() const { return _type == Type::EitherError; }
+    [[nodiscard]] constexpr bool isError() const { return _value.index() == Type::EitherError; }
 
     /**
      * Returns whether Either is an Error or a Value
      * @return true if value and false otherwise
      */
-    [[nodiscard]] bool isOk() const { return _type == Type::EitherValue; }
+    [[nodiscard]] constexpr bool isOk() const { return _value.index() == Type::EitherValue; }
 
     /**
      * Extracts the wrapped error from the Either
      * @return the error wrapped
      * @throws std::runtime_error when either contains value
      */
-    [[nodiscard]] ErrorType error() const {
+    [[nodiscard]] constexpr ErrorType error() const& {
         if (isError()) return std::get<Type::EitherError>(_value);
         throw std::runtime_error("Error not defined");
     }
 
+    /**
+     * Extracts the wrapped error from the Either by moving it out
+     * @return the error wrapped
+     * @throws std::runtime_error when either contains value
+     */
+    [[nodiscard]] constexpr ErrorType error() && {
+        if (isError()) return std::get<Type::EitherError>(std::move(_value));
+        throw std::runtime_error("Error not defined");
+    }
+
+    /**
+     * Unchecked access to the wrapped error. The error must exist, which is
+     * only asserted in debug builds
+     * @return const reference to the wrapped error
+     */
+    [[nodiscard]] constexpr const ErrorType& error_ref() const& {
+        YAFL_ASSERT(isError(), "error_ref() called without error");
+        return *std::get_if<Type::EitherError>(&_value);
+    }
+
     /**
      * Extracts the wrapped value from the Either
      * @return the value wrapped
      * @throws std::runtime_error when either contains error
      */
-    [[nodiscard]] ValueType value() const {
+    [[nodiscard]] constexpr ValueType value() const& {
         if (isOk()) return std::get<Type::EitherValue>(_value);
         throw std::runtime_error("Ok not defined");
     }
 
+    /**
+     * Extracts the wrapped value from the Either by moving it out
+     * @return the value wrapped
+     * @throws std::runtime_error when either contains error
+     */
+    [[nodiscard]] constexpr ValueType value() && {
+        if (isOk()) return std::get<Type::EitherValue>(std::move(_value));
+        throw std::runtime_error("Ok not defined");
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return const reference to the wrapped value
+     */
+    [[nodiscard]] constexpr const ValueType& value_ref() const& {
+        YAFL_ASSERT(isOk(), "value_ref() called without value");
+        return *std::get_if<Type::EitherValue>(&_value);
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return reference to the wrapped value
+     */
+    constexpr const ValueType& operator*() const& {
+        YAFL_ASSERT(isOk(), "operator*() called without value");
+        return *std::get_if<Type::EitherValue>(&_value);
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return reference to the wrapped value
+     */
+    constexpr ValueType& operator*() & {
+        YAFL_ASSERT(isOk(), "operator*() called without value");
+        return *std::get_if<Type::EitherValue>(&_value);
+    }
+
+    /**
+     * Unchecked access to the wrapped value that allows moving it out.
+     * The value must exist, which is only asserted in debug builds
+     * @return rvalue reference to the wrapped value
+     */
+    constexpr ValueType&& operator*() && {
+        YAFL_ASSERT(isOk(), "operator*() called without value");
+        return std::move(*std::get_if<Type::EitherValue>(&_value));
+    }
+
+    /**
+     * Unchecked member access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return pointer to the wrapped value
+     */
+    constexpr const ValueType* operator->() const {
+        YAFL_ASSERT(isOk(), "operator->() called without value");
+        return std::get_if<Type::EitherValue>(&_value);
+    }
+
+    /**
+     * Unchecked member access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return pointer to the wrapped value
+     */
+    constexpr ValueType* operator->() {
+        YAFL_ASSERT(isOk(), "operator->() called without value");
+        return std::get_if<Type::EitherValue>(&_value);
+    }
+
     /**
      * Extracts the wrapped value from the Either if exists or returns
      * te provided default value if either contains error
      * @param defaultValue Default value
      * @return the wrapped value or default
      */
-    [[nodiscard]] ValueType valueOr(const ValueType& defaultValue) const {
+    [[nodiscard]] constexpr ValueType valueOr(const ValueType& defaultValue) const& {
         return (isOk()) ? std::get<Type::EitherValue>(_value) : defaultValue;
     }
 
+    /**
+     * Extracts the wrapped value from the Either by moving it out if exists or
+     * returns the provided default value if either contains error
+     * @param defaultValue Default value
+     * @return the wrapped value or default
+     */
+    [[nodiscard]] constexpr ValueType valueOr(ValueType defaultValue) && {
+        return (isOk()) ? std::get<Type::EitherValue>(std::move(_value)) : std::move(defaultValue);
+    }
+
     /**
      * Extracts the wrapped error from the Either if exists or returns
      * te provided default error if either contains a value
      * @param defaultError Default value
      * @return the wrapped error or default
      */
-    [[nodiscard]] ErrorType errorOr(const ErrorType& defaultError) const {
+    [[nodiscard]] constexpr ErrorType errorOr(const ErrorType& defaultError) const& {
         return (isError()) ? std::get<Type::EitherError>(_value) : defaultError;
     }
 
+    /**
+     * Extracts the wrapped error from the Either by moving it out if exists or
+     * returns the provided default error if either contains a value
+     * @param defaultError Default value
+     * @return the wrapped error or default
+     */
+    [[nodiscard]] constexpr ErrorType errorOr(ErrorType defaultError) && {
+        return (isError()) ? std::get<Type::EitherError>(std::move(_value)) : std::move(defaultError);
+    }
+
 private:
     template <typename Callable>
-    decltype(auto) internal_bind(Callable&& callable) const {
+    constexpr decltype(auto) internal_bind(Callable&& callable) const& {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<ValueType>>, "Input argument is not invocable");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<ValueType>>>;
+        using InnerTypeError = typename type::DomainTypeInfo<ReturnType>::ErrorType;
+        static_assert(std::is_same_v<ErrorType, InnerTypeError>, "Error type does not match");
+        using InnerTypeOK = typename type::DomainTypeInfo<ReturnType>::ValueType;
+        if (isOk()) {
+            return function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(std::get<Type::EitherValue>(_value)));
+        } else {
+            return Either<ErrorType, InnerTypeOK>::Error(std::get<Type::EitherError>(_value));
+        }
+    }
+
+    template <typename Callable>
+    constexpr decltype(auto) internal_bind(Callable&& callable) && {
         static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<ValueType>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<ValueType>>>;
         using InnerTypeError = typename type::DomainTypeInfo<ReturnType>::ErrorType;
         static_assert(std::is_same_v<ErrorType, InnerTypeError>, "Error type does not match");
         using InnerTypeOK = typename type::DomainTypeInfo<ReturnType>::ValueType;
         if (isOk()) {
-            return std::invoke<Callable>(std::forward<Callable>(callable), value());
+            return function::invoke(std::forward<Callable>(callable), std::move(*this).value());
+        } else {
+            return Either<ErrorType, InnerTypeOK>::Error(std::move(*this).error());
+        }
+    }
+
+    template <typename Callable>
+    constexpr decltype(auto) internal_fmap(Callable&& callable) const& {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<ValueType>>, "Input argument is not invocable");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<ValueType>>>;
+        if (isOk()) {
+            if constexpr (std::is_void_v<ReturnType>) {
+                function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(std::get<Type::EitherValue>(_value)));
+                return Either<ErrorType, ReturnType>::Ok();
+            } else {
+                return Either<ErrorType, ReturnType>::Ok(function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(std::get<Type::EitherValue>(_value))));
+            }
         } else {
-            return Either<ErrorType, InnerTypeOK>::Error(error());
+            return Either<ErrorType, ReturnType>::Error(std::get<Type::EitherError>(_value));
         }
     }
 
     template <typename Callable>
-    decltype(auto) internal_fmap(Callable&& callable) const {
+    constexpr decltype(auto) internal_fmap(Callable&& callable) && {
         static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<ValueType>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<ValueType>>>;
         if (isOk()) {
             if constexpr (std::is_void_v<ReturnType>) {
-                std::invoke<Callable>(std::forward<Callable>(callable), value());
+                function::invoke(std::forward<Callable>(callable), std::move(*this).value());
                 return Either<ErrorType, ReturnType>::Ok();
             } else {
-                return Either<ErrorType, ReturnType>::Ok(std::invoke<Callable>(std::forward<Callable>(callable), value()));
+                return Either<ErrorType, ReturnType>::Ok(function::invoke(std::forward<Callable>(callable), std::move(*this).value()));
             }
         } else {
-            return Either<ErrorType, ReturnType>::Error(error());
+            return Either<ErrorType, ReturnType>::Error(std::move(*this).error());
         }
     }
 
     template<typename Arg>
-    decltype(auto) internal_apply(Arg&& arg) const {
+    constexpr decltype(auto) internal_apply(Arg&& arg) const {
         static_assert(!std::is_invocable_v<std::decay_t<ValueType>>, "Function that takes 0 arguments cannot be called with arguments");
         if constexpr (type::DomainTypeInfo<Arg>::hasMonadicBase) {
             if (arg.isOk()) {
@@ -758,7 +1237,7 @@ private:
     }
 
     template<typename Arg>
-    decltype(auto) internal_apply_non_monad(Arg&& arg) const {
+    constexpr decltype(auto) internal_apply_non_monad(Arg&& arg) const {
         if constexpr (std::is_invocable_v<std::decay_t<ValueType>, std::decay_t<Arg>>) {
             using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<ValueType>, std::decay_t<Arg>>>;
             if (isError()) {
@@ -775,27 +1254,29 @@ private:
             using PartialFunctionType = std::remove_reference_t<typename function::Info<ValueType>::PartialApplyFirst>;
 
             if (isOk()) {
-                return Either<ErrorType, PartialFunctionType>::Ok([callable = value(), first = std::forward<Arg>(arg)](auto&& ...args) {
-                    return std::apply(callable, std::tuple_cat(std::make_tuple(first), std::make_tuple(args...)));
-                        });
+                return Either<ErrorType, PartialFunctionType>::Ok(
+                        function::BoundCall<std::decay_t<ValueType>, typename function::Info<ValueType>::DeclaredArgTypes, std::decay_t<Arg>>(
+                                value(), std::forward<Arg>(arg)));
             } else {
                 return Either<ErrorType, PartialFunctionType>::Error(this->error());
             }
         }
     }
 
-    decltype(auto) internal_apply() const {
-        static_assert(std::is_invocable_v<std::decay_t<ValueType>>, "Function that takes one or more arguments cannot be called without arguments");
-        if constexpr (std::is_invocable_v<std::decay_t<ValueType>>) {
-            using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<ValueType>>>;
+    // member template, see Either<void, V>::internal_apply
+    template <typename Callable = ValueType>
+    constexpr decltype(auto) internal_apply() const {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Function that takes one or more arguments cannot be called without arguments");
+        if constexpr (std::is_invocable_v<std::decay_t<Callable>>) {
+            using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
             if (isError()) {
                 return Either<ErrorType, ReturnType>::Error(error());
             } else {
                 if constexpr (std::is_void_v<ReturnType>) {
-                    std::invoke<ValueType>(value());
+                    std::invoke<Callable>(value());
                     return Either<ErrorType, ReturnType>::Ok();
                 } else {
-                    return Either<ErrorType, ReturnType>::Ok(std::invoke<ValueType>(value()));
+                    return Either<ErrorType, ReturnType>::Ok(std::invoke<Callable>(value()));
                 }
             }
         } else {
@@ -804,8 +1285,8 @@ private:
     }
 
 private:
+    ///The active alternative of the variant is the only discriminant
     std::variant<ErrorType, ValueType> _value;
-    Type _type;
 };
 
 namespace either {
@@ -820,7 +1301,7 @@ namespace either {
  * @return valid value Either
  */
 template<typename ErrorType, typename ValueType>
-std::enable_if_t<std::is_void_v<ValueType> && std::is_void_v<ErrorType>, Either<void, void>>
+constexpr std::enable_if_t<std::is_void_v<ValueType> && std::is_void_v<ErrorType>, Either<void, void>>
 Ok() { return Either<void, void>::Ok(); }
 
 /**
@@ -833,7 +1314,7 @@ Ok() { return Either<void, void>::Ok(); }
  * @return valid value Either
  */
 template<typename ErrorType, typename ValueType>
-std::enable_if_t<(!std::is_void_v<ErrorType>) && std::is_void_v<ValueType>, Either<ErrorType, void>>
+constexpr std::enable_if_t<(!std::is_void_v<ErrorType>) && std::is_void_v<ValueType>, Either<ErrorType, void>>
 Ok() { return Either<ErrorType, void>::Ok(); }
 
 /**
@@ -847,7 +1328,7 @@ Ok() { return Either<ErrorType, void>::Ok(); }
  * @return valid value Either
  */
 template<typename ErrorType, typename ValueType>
-std::enable_if_t<!std::is_void_v<ErrorType> && !std::is_void_v<ValueType>, Either<ErrorType, ValueType>>
+constexpr std::enable_if_t<!std::is_void_v<ErrorType> && !std::is_void_v<ValueType>, Either<ErrorType, ValueType>>
 Ok(const ValueType& arg) { return Either<ErrorType, ValueType>::Ok(arg); }
 
 /**
@@ -861,7 +1342,7 @@ Ok(const ValueType& arg) { return Either<ErrorType, ValueType>::Ok(arg); }
  * @return valid value Either
  */
 template<typename ErrorType, typename ValueType>
-std::enable_if_t<std::is_void_v<ErrorType> && !std::is_void_v<ValueType>, Either<void, ValueType>>
+constexpr std::enable_if_t<std::is_void_v<ErrorType> && !std::is_void_v<ValueType>, Either<void, ValueType>>
 Ok(const ValueType& arg) { return Either<void, ValueType>::Ok(arg); }
 
 /**
@@ -873,7 +1354,7 @@ Ok(const ValueType& arg) { return Either<void, ValueType>::Ok(arg); }
  * @return valid eror Either
  */
 template<typename ErrorType, typename ValueType>
-std::enable_if_t<std::is_void_v<ErrorType> && std::is_void_v<ValueType>, Either<void, void>>
+constexpr std::enable_if_t<std::is_void_v<ErrorType> && std::is_void_v<ValueType>, Either<void, void>>
 Error() { return Either<void, void>::Error(); }
 
 /**
@@ -887,7 +1368,7 @@ Error() { return Either<void, void>::Error(); }
  * @return valid error Either
  */
 template<typename ErrorType, typename ValueType>
-std::enable_if_t<!std::is_void_v<ErrorType> && std::is_void_v<ValueType>, Either<ErrorType, void>>
+constexpr std::enable_if_t<!std::is_void_v<ErrorType> && std::is_void_v<ValueType>, Either<ErrorType, void>>
 Error(const ErrorType& arg) { return Either<ErrorType, void>::Error(arg); }
 
 /**
@@ -901,7 +1382,7 @@ Error(const ErrorType& arg) { return Either<ErrorType, void>::Error(arg); }
  * @return valid error Either
  */
 template<typename ErrorType, typename ValueType>
-std::enable_if_t<!std::is_void_v<ErrorType> && !std::is_void_v<ValueType>, Either<ErrorType, ValueType>>
+constexpr std::enable_if_t<!std::is_void_v<ErrorType> && !std::is_void_v<ValueType>, Either<ErrorType, ValueType>>
 Error(const ErrorType& arg) { return Either<ErrorType, ValueType>::Error(arg); }
 
 /**
@@ -914,25 +1395,64 @@ Error(const ErrorType& arg) { return Either<ErrorType, ValueType>::Error(arg); }
  * @return valid error Either
  */
 template<typename ErrorType, typename ValueType>
-std::enable_if_t<std::is_void_v<ErrorType> && !std::is_void_v<ValueType>, Either<void, ValueType>>
+constexpr std::enable_if_t<std::is_void_v<ErrorType> && !std::is_void_v<ValueType>, Either<void, ValueType>>
 Error() { return Either<void, ValueType>::Error(); }
 
+/**
+ * @ingroup Either
+ *
+ * Helper function to create an Either that is an Ok.
+ * Is this case this function is applicable when value type is not void and the argument
+ * is forwarded, i.e, rvalues are moved into the Either instead of copied.
+ * @tparam ErrorType Type of error
+ * @tparam ValueType Type of value
+ * @param arg Value to be wrapped
+ * @return valid value Either
+ */
+template<typename ErrorType, typename ValueType>
+constexpr std::enable_if_t<!std::is_void_v<ValueType>, Either<ErrorType, std::decay_t<ValueType>>>
+Ok(ValueType&& arg) { return Either<ErrorType, std::decay_t<ValueType>>::Ok(std::forward<ValueType>(arg)); }
 
-namespace details {
-    template<typename ErrorType, typename Head>
-    ErrorType getFailedValue(const Head& head) {
-        return head.error();
-    }
+/**
+ * @ingroup Either
+ *
+ * Helper function to create an Either that is an Ok with the value constructed in place.
+ * @tparam ErrorType Type of error
+ * @tparam ValueType Type of value
+ * @param args Arguments forwarded to the constructor of ValueType
+ * @return valid value Either
+ */
+template<typename ErrorType, typename ValueType, typename ...Args>
+constexpr std::enable_if_t<!std::is_void_v<ValueType>, Either<ErrorType, ValueType>>
+Ok(std::in_place_t, Args&& ...args) { return Either<ErrorType, ValueType>::Ok(std::in_place, std::forward<Args>(args)...); }
 
-    template<typename ErrorType, typename Head, typename ...Tail>
-    ErrorType getFailedValue(const Head& head, Tail&& ...tail) {
-        if (head.isError()) {
-            return head.error();
-        } else {
-            return getFailedValue<ErrorType>(std::forward<Tail>(tail)...);
-        }
-    }
-}
+/**
+ * @ingroup Either
+ *
+ * Helper function to create an Either that is an Error.
+ * Is this case this function is applicable when error type is not void and the argument
+ * is an rvalue, which is moved into the Either instead of copied.
+ * @tparam ErrorType Type of error
+ * @tparam ValueType Type of value
+ * @param arg Error to be wrapped
+ * @return valid error Either
+ */
+template<typename ErrorType, typename ValueType>
+constexpr std::enable_if_t<!std::is_void_v<ErrorType> && !std::is_reference_v<ErrorType>, Either<ErrorType, ValueType>>
+Error(ErrorType&& arg) { return Either<ErrorType, ValueType>::Error(std::move(arg)); }
+
+/**
+ * @ingroup Either
+ *
+ * Helper function to create an Either that is an Error with the error constructed in place.
+ * @tparam ErrorType Type of error
+ * @tparam ValueType Type of value
+ * @param args Arguments forwarded to the constructor of ErrorType
+ * @return valid error Either
+ */
+template<typename ErrorType, typename ValueType, typename ...Args>
+constexpr std::enable_if_t<!std::is_void_v<ErrorType>, Either<ErrorType, ValueType>>
+Error(std::in_place_t, Args&& ...args) { return Either<ErrorType, ValueType>::Error(std::in_place, std::forward<Args>(args)...); }
 
 
 /**
@@ -961,28 +1481,102 @@ decltype(auto) lift(Callable&& callable) {
     } else {
         using ReturnType = typename function::Info<Callable>::ReturnType;
         using PinErrorType = typename type::PinErrorType<ErrorType>;
-        using ReturnFunctionType = typename function::Info<Callable>::template LiftedSignature<PinErrorType::template Type>;
+        using LiftedArgsTuple = typename function::Info<Callable>::template LiftedArgTypes<PinErrorType::template Type>;
+        using DeclaredArgsTuple = typename function::Info<Callable>::DeclaredArgTypes;
 
-        const ReturnFunctionType function =  [callable = std::forward<Callable>(callable)](auto&& ...args) -> Either<ErrorType, ReturnType> {
-            if (all([](const auto &v) { return v.isOk(); }, args...)) {
-                const auto tp = tuple::map_append([](auto&& arg){ return arg.value();}, std::make_tuple(), args...);
-                if constexpr (std::is_void_v<ReturnType>) {
-                    std::apply(callable, tp);
-                    return Either<ErrorType, ReturnType>::Ok();
-                } else {
-                    return Either<ErrorType, ReturnType>::Ok(std::apply(callable, tp));
+        return function::make_closure<Either<ErrorType, ReturnType>, LiftedArgsTuple>([callable = std::forward<Callable>(callable)](auto&& ...args) -> Either<ErrorType, ReturnType> {
+            // single pass that short-circuits on the first error, remembering it
+            if constexpr (std::is_void_v<ErrorType>) {
+                if (!(args.isOk() && ...)) {
+                    return Either<ErrorType, ReturnType>::Error();
                 }
             } else {
-                if constexpr (std::is_void_v<ErrorType>) {
-                    return Either<ErrorType, ReturnType>::Error();
-                } else {
-                    return Either<ErrorType, ReturnType>::Error(details::getFailedValue<ErrorType>(args...));
+                const ErrorType* failed = nullptr;
+                if (!((args.isOk() || (failed = &args.error_ref(), false)) && ...)) {
+                    return Either<ErrorType, ReturnType>::Error(*failed);
                 }
             }
-        };
 
-        return function;
+            if constexpr (std::is_void_v<ReturnType>) {
+                function::invoke_unwrapped<DeclaredArgsTuple>(callable, std::forward<decltype(args)>(args)...);
+                return Either<ErrorType, ReturnType>::Ok();
+            } else {
+                return Either<ErrorType, ReturnType>::Ok(function::invoke_unwrapped<DeclaredArgsTuple>(callable, std::forward<decltype(args)>(args)...));
+            }
+        });
+    }
+}
+
+namespace details {
+template<typename ErrorType, typename ValueType, typename Failed>
+constexpr Either<ErrorType, ValueType> propagateError(Failed&& failed) {
+    if constexpr (std::is_void_v<ErrorType>) {
+        return Either<ErrorType, ValueType>::Error();
+    } else {
+        return Either<ErrorType, ValueType>::Error(std::forward<Failed>(failed).error());
+    }
+}
+} // namespace details
+
+/**
+ * @ingroup Either
+ *
+ * Applies given callable to every element of the range and collects the Ok values.
+ * Stops at the first Error, which is returned. The output is reserved once when the range
+ * size is known and elements are moved to the callable when the range is an rvalue.
+ * @tparam Range range type
+ * @tparam Callable Callable type, receives an element and returns an Either
+ * @param range range to traverse
+ * @param callable callable to apply to every element
+ * @return Either with a vector holding all the values, or the first Error returned by callable
+ */
+template<typename Range, typename Callable>
+auto traverse(Range&& range, Callable&& callable) {
+    using ResultType = std::decay_t<std::invoke_result_t<Callable&, range::ForwardedElement<Range&&>>>;
+    static_assert(type::DomainTypeInfo<ResultType>::hasMonadicBase, "Callable must return an Either");
+    using ErrorType = typename type::DomainTypeInfo<ResultType>::ErrorType;
+    using ValueType = typename type::DomainTypeInfo<ResultType>::ValueType;
+    static_assert(!std::is_void_v<ValueType>, "Cannot collect Either<E, void> values");
+
+    std::vector<ValueType> values;
+    range::reserve(values, range);
+    for (auto&& element : range) {
+        auto result = function::invoke(callable, range::forward_element<Range&&>(element));
+        if (result.isError()) {
+            return details::propagateError<ErrorType, std::vector<ValueType>>(std::move(result));
+        }
+        values.push_back(*std::move(result));
+    }
+    return Either<ErrorType, std::vector<ValueType>>::Ok(std::move(values));
+}
+
+/**
+ * @ingroup Either
+ *
+ * Turns a range of Either into an Either of a vector with the Ok values.
+ * Stops at the first Error, which is returned. The output is reserved once when the range
+ * size is known and values are moved out when the range is an rvalue.
+ * @tparam Range range type, its elements must be Either
+ * @param range range of Either
+ * @return Either with a vector holding all the values, or the first Error in the range
+ */
+template<typename Range>
+auto sequence(Range&& range) {
+    using ElementType = std::decay_t<range::ForwardedElement<Range&&>>;
+    static_assert(type::DomainTypeInfo<ElementType>::hasMonadicBase, "Range elements must be Either");
+    using ErrorType = typename type::DomainTypeInfo<ElementType>::ErrorType;
+    using ValueType = typename type::DomainTypeInfo<ElementType>::ValueType;
+    static_assert(!std::is_void_v<ValueType>, "Cannot collect Either<E, void> values");
+
+    std::vector<ValueType> values;
+    range::reserve(values, range);
+    for (auto&& element : range) {
+        if (element.isError()) {
+            return details::propagateError<ErrorType, std::vector<ValueType>>(range::forward_element<Range&&>(element));
+        }
+        values.push_back(*range::forward_element<Range&&>(element));
     }
+    return Either<ErrorType, std::vector<ValueType>>::Ok(std::move(values));
 }
 
 } // namespace either
@@ -0,0 +1,335 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    EitherVector Columnar Either
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "yafl/Assert.h"
+#include "yafl/Bitmap.h"
+#include "yafl/Either.h"
+#include "yafl/Functor.h"
+#include "yafl/TypeTraits.h"
+
+namespace yafl {
+
+/**
+ * @ingroup EitherVector
+ *
+ * Column of results, i.e, the columnar layout of a std::vector<Either<Error, Value>> for the case
+ * where errors are rare. Ok values are stored densely in a single array with one slot per row and
+ * an ok-bitmap tells which rows hold a value. Errors are stored sparsely, together with the index
+ * of their row, so their memory scales with the number of errors instead of the number of rows.
+ * Slots of error rows in the value array hold a value initialized Value, which is never passed to
+ * user callables.
+ *
+ * fmap runs the callable over every Ok value of the whole column, mapError over every error.
+ */
+template <typename Error, typename Value>
+class EitherVector;
+
+namespace type {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * EitherVector traits specialization that enable getting the inner error and value types.
+ * @tparam InnerError Error type
+ * @tparam InnerValue Value type
+ */
+template<typename InnerError, typename InnerValue>
+struct DomainDetailsImpl<EitherVector<InnerError, InnerValue>> {
+    /// Functor Base type
+    using FBaseType = core::Functor<EitherVector, InnerError, InnerValue>;
+    /// Value Type
+    using ValueType = InnerValue;
+    /// Error Type
+    using ErrorType = InnerError;
+    /// Derived type
+    using DerivedType = EitherVector<InnerError, InnerValue>;
+    ///boolean flag that states whether type T is a Functor or not
+    static constexpr bool hasFunctorBase = std::is_base_of_v<FBaseType, DerivedType>;
+    ///boolean flag that states whether type T is an Applicative or not
+    static constexpr bool hasApplicativeBase = false;
+    ///boolean flag that states whether type T is a Monad or not
+    static constexpr bool hasMonadicBase = false;
+    /// Same container holding another value type
+    template<typename T>
+    using RebindType = EitherVector<InnerError, T>;
+};
+} // namespace details
+} // namespace type
+
+template <typename Error, typename Value>
+class EitherVector : public core::Functor<EitherVector, Error, Value> {
+    friend class core::Functor<EitherVector, Error, Value>;
+
+    template <typename, typename> friend class EitherVector;
+
+    static_assert(!std::is_reference_v<Error> && !std::is_void_v<Error>, "EitherVector class cannot store references or void errors");
+    static_assert(!std::is_reference_v<Value> && !std::is_void_v<Value>, "EitherVector class cannot store references or void values");
+    static_assert(std::is_default_constructible_v<Value>, "EitherVector class requires a default constructible value type");
+
+public:
+    /**
+     * @ingroup EitherVector
+     *
+     * Read-only view over the errors of the column, in increasing row order
+     */
+    struct ErrorView {
+        /// Row index of every error
+        const std::size_t* indexes;
+        /// Errors, errors[i] belongs to row indexes[i]
+        const Error* errors;
+        /// Number of errors
+        std::size_t size;
+    };
+
+    /**
+     * @ingroup EitherVector
+     *
+     * Read-only view over the Ok values of the column
+     */
+    struct ValueView {
+        /// Dense values, one slot per row
+        const Value* values;
+        /// Ok bitmap, one bit per row
+        const bitmap::Word* ok;
+        /// Number of rows
+        std::size_t rows;
+        /// Number of Ok values
+        std::size_t size;
+
+        /**
+         * Calls given visitor with the row index and the value of every Ok row
+         * @tparam Visitor callable type receiving (std::size_t, const Value&)
+         * @param visitor callable to invoke for every Ok row
+         */
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const {
+            bitmap::forEachSet(ok, rows, [&](std::size_t index) { visitor(index, values[index]); });
+        }
+    };
+
+    /**
+     * Constructs an empty column
+     */
+    EitherVector() = default;
+
+    /**
+     * Constructs a column from a list of Either
+     * @param list rows of the column
+     */
+    EitherVector(std::initializer_list<Either<Error, Value>> list) {
+        reserve(list.size());
+        for (const auto& row : list) {
+            push_back(row);
+        }
+    }
+
+    /**
+     * Comparison operator overload. Only Ok values and errors are compared
+     * @param other column to compare to
+     * @return true if both columns have the same rows and false otherwise
+     */
+    bool operator==(const EitherVector<Error, Value>& other) const {
+        if (_size != other._size || _ok != other._ok || _errorIndexes != other._errorIndexes || _errors != other._errors) {
+            return false;
+        }
+        bool equal = true;
+        bitmap::forEachSet(_ok.data(), _size, [&](std::size_t index) {
+            equal = equal && (_values[index] == other._values[index]);
+        });
+        return equal;
+    }
+
+    /**
+     * Number of rows, Ok or error
+     * @return column size
+     */
+    [[nodiscard]] std::size_t size() const { return _size; }
+
+    /**
+     * Checks whether the column has no rows
+     * @return true if empty and false otherwise
+     */
+    [[nodiscard]] bool empty() const { return _size == 0; }
+
+    /**
+     * Number of error rows
+     * @return number of errors
+     */
+    [[nodiscard]] std::size_t errorCount() const { return _errors.size(); }
+
+    /**
+     * Reserves storage for the given number of rows. Error storage is not reserved,
+     * it only grows with the errors
+     * @param capacity number of rows
+     */
+    void reserve(std::size_t capacity) {
+        _values.reserve(capacity);
+        _ok.reserve(bitmap::words(capacity));
+    }
+
+    /**
+     * Appends an Ok row to the column
+     * @param value value to append
+     */
+    void push_back(Value value) {
+        append(true);
+        _values.push_back(std::move(value));
+    }
+
+    /**
+     * Appends a row to the column
+     * @param row value or error to append
+     */
+    void push_back(const Either<Error, Value>& row) {
+        if (row.isOk()) {
+            push_back(row.value_ref());
+        } else {
+            pushError(row.error_ref());
+        }
+    }
+
+    /**
+     * Appends an error row to the column
+     * @param error error to append
+     */
+    void pushError(Error error) {
+        _errorIndexes.push_back(_size);
+        _errors.push_back(std::move(error));
+        append(false);
+        _values.emplace_back();
+    }
+
+    /**
+     * Checks whether the row at given index holds a value
+     * @param index row index
+     * @return true if Ok and false if error
+     */
+    [[nodiscard]] bool isOk(std::size_t index) const {
+        YAFL_ASSERT(index < _size, "index out of range");
+        return bitmap::test(_ok.data(), index);
+    }
+
+    /**
+     * Row at the given index. Errors are looked up with a binary search
+     * @param index row index
+     * @return Either with a copy of the value or of the error of the row
+     */
+    [[nodiscard]] Either<Error, Value> operator[](std::size_t index) const {
+        if (isOk(index)) {
+            return Either<Error, Value>::Ok(_values[index]);
+        }
+        const auto position = std::lower_bound(_errorIndexes.begin(), _errorIndexes.end(), index) - _errorIndexes.begin();
+        return Either<Error, Value>::Error(_errors[static_cast<std::size_t>(position)]);
+    }
+
+    /**
+     * Applies given callable to every error of the column, keeping the Ok values
+     * @tparam Callable Callable type
+     * @param callable Callback to be executed for every error
+     * @return a new column with the mapped errors
+     */
+    template <typename Callable>
+    decltype(auto) mapError(Callable&& callable) const& {
+        return mapErrorColumn(*this, std::forward<Callable>(callable));
+    }
+
+    /**
+     * Applies given callable to every error of the column, keeping the Ok values.
+     * Rvalue overload: errors are moved into the callable and the values into the result.
+     * @tparam Callable Callable type
+     * @param callable Callback to be executed for every error
+     * @return a new column with the mapped errors
+     */
+    template <typename Callable>
+    decltype(auto) mapError(Callable&& callable) && {
+        return mapErrorColumn(std::move(*this), std::forward<Callable>(callable));
+    }
+
+    /**
+     * Splits the column into a view over its errors and a view over its Ok values.
+     * No data is copied, views are valid while the column is alive and unchanged
+     * @return pair with the error view and the value view
+     */
+    [[nodiscard]] std::pair<ErrorView, ValueView> partition() const {
+        return {ErrorView{_errorIndexes.data(), _errors.data(), _errors.size()},
+                ValueView{_values.data(), _ok.data(), _size, _size - _errors.size()}};
+    }
+
+private:
+    EitherVector(std::vector<Value> values, std::vector<bitmap::Word> ok,
+                 std::vector<std::size_t> errorIndexes, std::vector<Error> errors, std::size_t size)
+            : _values(std::move(values)), _ok(std::move(ok)), _errorIndexes(std::move(errorIndexes)),
+              _errors(std::move(errors)), _size{size} {}
+
+    void append(bool ok) {
+        if (_size % bitmap::WordBits == 0) {
+            _ok.push_back(0);
+        }
+        bitmap::assign(_ok.data(), _size, ok);
+        ++_size;
+    }
+
+    template <typename Self, typename Callable>
+    static decltype(auto) fmapColumn(Self&& self, Callable&& callable) {
+        using ValueArg = std::conditional_t<std::is_lvalue_reference_v<Self>, const Value&, Value&&>;
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, ValueArg>, "Input argument is not invocable");
+        using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, ValueArg>>;
+        static_assert(!std::is_void_v<ReturnType>, "Callable cannot return void");
+
+        std::vector<ReturnType> values(self._size);
+        auto& source = self._values;
+        bitmap::forEachSet(self._ok.data(), self._size, [&](std::size_t index) {
+            values[index] = function::invoke(callable, static_cast<ValueArg>(source[index]));
+        });
+        return EitherVector<Error, ReturnType>(std::move(values), std::forward<Self>(self)._ok,
+                                               std::forward<Self>(self)._errorIndexes,
+                                               std::forward<Self>(self)._errors, self._size);
+    }
+
+    template <typename Self, typename Callable>
+    static decltype(auto) mapErrorColumn(Self&& self, Callable&& callable) {
+        using ErrorArg = std::conditional_t<std::is_lvalue_reference_v<Self>, const Error&, Error&&>;
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, ErrorArg>, "Input argument is not invocable");
+        using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, ErrorArg>>;
+        static_assert(!std::is_void_v<ReturnType>, "Callable cannot return void");
+
+        std::vector<ReturnType> errors;
+        errors.reserve(self._errors.size());
+        for (auto& error : self._errors) {
+            errors.push_back(function::invoke(callable, static_cast<ErrorArg>(error)));
+        }
+        return EitherVector<ReturnType, Value>(std::forward<Self>(self)._values, std::forward<Self>(self)._ok,
+                                               std::forward<Self>(self)._errorIndexes, std::move(errors), self._size);
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_fmap(Callable&& callable) const& {
+        return fmapColumn(*this, std::forward<Callable>(callable));
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_fmap(Callable&& callable) && {
+        return fmapColumn(std::move(*this), std::forward<Callable>(callable));
+    }
+
+    std::vector<Value> _values;
+    std::vector<bitmap::Word> _ok;
+    std::vector<std::size_t> _errorIndexes;
+    std::vector<Error> _errors;
+    std::size_t _size = 0;
+};
+
+} // namespace yafl
@@ -0,0 +1,61 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Executor Executors
+ */
+#pragma once
+
+#include <functional>
+
+namespace yafl {
+namespace executor {
+
+/**
+ * @ingroup Executor
+ *
+ * Interface of the schedulers that run asynchronous work, e.g, Future continuations.
+ * Implementations decide where and when a task runs: inline, on a thread pool, on an event loop...
+ * An executor must outlive every task submitted to it.
+ */
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    /**
+     * Submits a task for execution
+     * @param task task to run, exactly once
+     */
+    virtual void execute(std::function<void()> task) = 0;
+};
+
+/**
+ * @ingroup Executor
+ *
+ * Executor that runs every task immediately on the calling thread
+ */
+class InlineExecutor final : public Executor {
+public:
+    /**
+     * Runs the task on the calling thread
+     * @param task task to run
+     */
+    void execute(std::function<void()> task) override {
+        task();
+    }
+};
+
+/**
+ * @ingroup Executor
+ *
+ * Process wide inline executor, default executor of Futures
+ * @return inline executor
+ */
+inline Executor& inlineExecutor() {
+    static InlineExecutor executor;
+    return executor;
+}
+
+} // namespace executor
+} // namespace yafl
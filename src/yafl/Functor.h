@@ -8,8 +8,8 @@
  */
 #pragma once
 
-#include <memory>
-#include <functional>
+#include <type_traits>
+#include <utility>
 #include "TypeTraits.h"
 
 namespace yafl {
@@ -35,8 +35,20 @@ public:
      * @return a new Functor with the result from the application of the function
      */
     template<typename Callable>
-    decltype(auto) fmap(Callable&& callable) const {
-        return static_cast<const TDerivedFunctor<Args...> *>(this)->internal_fmap(std::forward<Callable>(callable));
+    constexpr decltype(auto) fmap(Callable&& callable) const& {
+        return static_cast<const TDerivedFunctor<Args...>&>(*this).internal_fmap(std::forward<Callable>(callable));
+    }
+
+    /**
+     * Binds given callable (function, function object, lambda) to the Functor value.
+     * Rvalue overload: the wrapped value is moved into the callable instead of being copied.
+     * @tparam Callable Callable type
+     * @param callable Callback to be executed
+     * @return a new Functor with the result from the application of the function
+     */
+    template<typename Callable>
+    constexpr decltype(auto) fmap(Callable&& callable) && {
+        return static_cast<TDerivedFunctor<Args...>&&>(*this).internal_fmap(std::forward<Callable>(callable));
     }
 };
 
@@ -54,9 +66,9 @@ namespace functor {
  * @return Functor type containing the result of the function application
  */
 template<typename Callable, typename FunctorT>
-decltype(auto) fmap(Callable&& callable, const FunctorT& functor) {
+constexpr decltype(auto) fmap(Callable&& callable, FunctorT&& functor) {
     static_assert(type::DomainTypeInfo<FunctorT>::hasFunctorBase, "FunctorT argument not a Functor");
-    return functor.fmap(std::forward<Callable>(callable));
+    return std::forward<FunctorT>(functor).fmap(std::forward<Callable>(callable));
 }
 
 /**
@@ -72,7 +84,7 @@ decltype(auto) fmap(Callable&& callable, const FunctorT& functor) {
  * @return Function lifted to work at Functor level
  */
 template<template<typename...> typename FunctorType, typename Callable>
-decltype(auto) fmap(Callable&& callable) {
+constexpr decltype(auto) fmap(Callable&& callable) {
     if constexpr (std::is_invocable_v<Callable>) {
         return [callable = std::forward<Callable>(callable)](const FunctorType<void>& functor) {
             static_assert(type::DomainTypeInfo<FunctorType<void>>::hasFunctorBase, "Argument not a Functor");
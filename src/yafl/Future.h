@@ -0,0 +1,516 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Future Future
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "yafl/Applicative.h"
+#include "yafl/Assert.h"
+#include "yafl/Either.h"
+#include "yafl/Executor.h"
+#include "yafl/Functor.h"
+#include "yafl/Monad.h"
+#include "yafl/TypeTraits.h"
+
+namespace yafl {
+
+/**
+ * @ingroup Future
+ *
+ * Asynchronous Either: a result, Error or Ok, that may only be available later.
+ * fmap and bind never block, they register a continuation that runs once the result is set.
+ * When the result is already available the continuation runs inline, on the calling thread,
+ * so ready futures never go through the executor. Otherwise, the continuation is submitted to
+ * the executor of the future when the result is set.
+ *
+ * Futures are cheap handles to a shared state: copies observe the same result and each
+ * continuation receives it by const reference.
+ *
+ * An exception thrown by a callable, either a continuation or the work of future::async, is
+ * stored in the derived future instead of escaping to the executor. It skips the continuations
+ * registered after it, like an Error does, and get() rethrows it.
+ */
+template <typename ErrorType, typename ValueType>
+class Future;
+
+template <typename ErrorType, typename ValueType>
+class Promise;
+
+namespace type {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * Future traits specialization that enable getting the inner error and value types.
+ * @tparam InnerError Error type
+ * @tparam InnerValue Value type
+ */
+template<typename InnerError, typename InnerValue>
+struct DomainDetailsImpl<Future<InnerError, InnerValue>> {
+    /// Functor Base type
+    using FBaseType = core::Functor<Future, InnerError, InnerValue>;
+    /// Applicative Base type
+    using ABaseType = core::Applicative<Future, InnerError, InnerValue>;
+    /// Monad Base type
+    using MBaseType = core::Monad<Future, InnerError, InnerValue>;
+    /// Value Type
+    using ValueType = InnerValue;
+    /// Error Type
+    using ErrorType = InnerError;
+    /// Derived type
+    using DerivedType = Future<InnerError, InnerValue>;
+    ///boolean flag that states whether type T is a Functor or not
+    static constexpr bool hasFunctorBase = std::is_base_of_v<FBaseType, DerivedType>;
+    ///boolean flag that states whether type T is an Applicative or not
+    static constexpr bool hasApplicativeBase = std::is_base_of_v<ABaseType, DerivedType>;
+    ///boolean flag that states whether type T is a Monad or not
+    static constexpr bool hasMonadicBase = std::is_base_of_v<MBaseType, DerivedType>;
+    ///boolean flag that states that the value of T has to be chained, not inspected
+    static constexpr bool isAsync = true;
+    ///Callback responsible for handling errors
+    static constexpr auto handleError = [](auto &&...args) {
+        static_assert(std::is_same_v<typename type::DomainTypeInfo<decltype(args)...>::ErrorType, ErrorType>, "Error types should match");
+        return DerivedType::Error(args.error()...);
+    };
+    ///Callback responsible for wrapping a value into the Derived type
+    static constexpr auto wrapValue = [](auto&& value) {
+        return DerivedType::Ok(std::forward<decltype(value)>(value));
+    };
+    /// Same monad holding another value type
+    template<typename T>
+    using RebindType = Future<InnerError, T>;
+};
+} // namespace details
+} // namespace type
+
+namespace future {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * State shared by a Promise and its Futures: the result or the exception, once set, and the
+ * continuations registered before it was set.
+ */
+template <typename ErrorType, typename ValueType>
+class SharedState : public std::enable_shared_from_this<SharedState<ErrorType, ValueType>> {
+public:
+    using ResultType = Either<ErrorType, ValueType>;
+    using Continuation = std::function<void(const SharedState&)>;
+
+    explicit SharedState(executor::Executor& executor) : _executor{&executor} {}
+
+    SharedState(executor::Executor& executor, ResultType result)
+            : _executor{&executor}, _result{std::move(result)}, _ready{true} {}
+
+    [[nodiscard]] bool isReady() const {
+        return _ready.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] executor::Executor& executor() const {
+        return *_executor;
+    }
+
+    /**
+     * Result of a ready state
+     * @return the result
+     * @throws the exception the state was completed with, if any
+     */
+    [[nodiscard]] const ResultType& result() const {
+        YAFL_ASSERT(isReady(), "result() called before the result was set");
+        if (_exception) {
+            std::rethrow_exception(_exception);
+        }
+        return *_result;
+    }
+
+    void wait() const {
+        if (isReady()) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _ready.load(std::memory_order_relaxed); });
+    }
+
+    void set(ResultType result) {
+        complete([this, &result]() { _result.emplace(std::move(result)); });
+    }
+
+    void setException(std::exception_ptr exception) {
+        complete([this, &exception]() { _exception = std::move(exception); });
+    }
+
+    /**
+     * Completes a state left unset by its last promise with a std::future_error(broken_promise),
+     * so its futures and continuations do not wait forever
+     */
+    void abandon() noexcept {
+        if (isReady()) {
+            return;
+        }
+        try {
+            setException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+        } catch (...) {
+            // called while destroying the last promise, which must not throw
+        }
+    }
+
+    /**
+     * Runs the callable with this state once it is ready, inline if it already is.
+     * The callable must not throw, see details::settle
+     */
+    template <typename Callable>
+    void then(Callable&& callable) {
+        if (!isReady()) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_ready.load(std::memory_order_relaxed)) {
+                _continuations.emplace_back(std::forward<Callable>(callable));
+                return;
+            }
+        }
+        callable(*this);
+    }
+
+private:
+    template <typename Store>
+    void complete(Store&& store) {
+        std::vector<Continuation> continuations;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            // futures may be reading the result already, so it is never overwritten
+            if (_ready.load(std::memory_order_relaxed)) {
+                throw std::logic_error("Future result already set");
+            }
+            store();
+            _ready.store(true, std::memory_order_release);
+            continuations.swap(_continuations);
+        }
+        _condition.notify_all();
+        for (auto& continuation : continuations) {
+            _executor->execute([self = this->shared_from_this(), continuation = std::move(continuation)]() {
+                continuation(*self);
+            });
+        }
+    }
+
+    executor::Executor* _executor;
+    std::optional<ResultType> _result;
+    std::exception_ptr _exception;
+    std::atomic<bool> _ready{false};
+    std::vector<Continuation> _continuations;
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _condition;
+};
+} // namespace details
+} // namespace future
+
+/**
+ * @ingroup Future
+ *
+ * Producer side of a Future: sets the result, exactly once, and wakes up its continuations.
+ * Copies of a promise share its state. If the last copy is destroyed before the result is set,
+ * the future completes with a std::future_error(broken_promise) exception.
+ */
+template <typename ErrorType, typename ValueType>
+class Promise {
+    using State = future::details::SharedState<ErrorType, ValueType>;
+
+public:
+    /**
+     * Constructor
+     * @param executor executor running the continuations of the future once the result is set
+     */
+    explicit Promise(executor::Executor& executor = executor::inlineExecutor())
+            : _state{makeState(executor)} {}
+
+    /**
+     * Future that completes when the result of this promise is set
+     * @return future sharing the state of the promise
+     */
+    [[nodiscard]] Future<ErrorType, ValueType> future() const {
+        return Future<ErrorType, ValueType>(_state->shared_from_this());
+    }
+
+    /**
+     * Sets the result and schedules the registered continuations
+     * @param result Error or Ok result
+     * @throws std::logic_error when the result was already set
+     */
+    void set(Either<ErrorType, ValueType> result) {
+        _state->set(std::move(result));
+    }
+
+    /**
+     * Sets an Ok result
+     * @param value value of the result
+     */
+    void setValue(ValueType value) {
+        set(Either<ErrorType, ValueType>::Ok(std::move(value)));
+    }
+
+    /**
+     * Sets an Error result
+     * @param error error of the result
+     */
+    void setError(ErrorType error) {
+        set(Either<ErrorType, ValueType>::Error(std::move(error)));
+    }
+
+    /**
+     * Completes the future with an exception instead of a result. get() rethrows it
+     * @param exception exception to store
+     * @throws std::logic_error when the result was already set
+     */
+    void setException(std::exception_ptr exception) {
+        _state->setException(std::move(exception));
+    }
+
+private:
+    /**
+     * Handle on a new state shared by the promise copies only: its deleter runs when the last
+     * copy is destroyed, abandoning the state, and then releases the state itself
+     */
+    static std::shared_ptr<State> makeState(executor::Executor& executor) {
+        auto state = std::make_shared<State>(executor);
+        State* raw = state.get();
+        return std::shared_ptr<State>(raw, [state = std::move(state)](State*) mutable {
+            state->abandon();
+            state.reset();
+        });
+    }
+
+    std::shared_ptr<State> _state;
+};
+
+namespace future {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * Sets the result returned by the producer on the promise, or the exception it throws
+ * @param promise promise to complete
+ * @param producer callable returning the result
+ */
+template <typename ErrorType, typename ValueType, typename Producer>
+void settle(Promise<ErrorType, ValueType>& promise, Producer&& producer) {
+    try {
+        promise.set(producer());
+    } catch (...) {
+        promise.setException(std::current_exception());
+    }
+}
+} // namespace details
+} // namespace future
+
+template <typename ErrorType, typename ValueType>
+class Future : public core::Functor<Future, ErrorType, ValueType>
+             , public core::Applicative<Future, ErrorType, ValueType>
+             , public core::Monad<Future, ErrorType, ValueType> {
+    friend class core::Functor<Future, ErrorType, ValueType>;
+    friend class core::Applicative<Future, ErrorType, ValueType>;
+    friend class core::Monad<Future, ErrorType, ValueType>;
+    friend class Promise<ErrorType, ValueType>;
+
+    template <typename, typename> friend class Future;
+
+    static_assert(!std::is_reference_v<ErrorType> && !std::is_void_v<ErrorType>, "Future class cannot hold references or void errors");
+    static_assert(!std::is_reference_v<ValueType> && !std::is_void_v<ValueType>, "Future class cannot hold references or void values");
+
+    using State = future::details::SharedState<ErrorType, ValueType>;
+
+public:
+    /// Type of the result
+    using ResultType = Either<ErrorType, ValueType>;
+
+    /**
+     * Constructs a Future whose result is already available
+     * @param result Error or Ok result
+     * @param executor executor of the continuations of the derived futures that are not ready
+     * @return ready future
+     */
+    static Future<ErrorType, ValueType> Ready(ResultType result, executor::Executor& executor = executor::inlineExecutor()) {
+        return Future<ErrorType, ValueType>(std::make_shared<State>(executor, std::move(result)));
+    }
+
+    /**
+     * Constructs a ready Future holding a value
+     * @param value value to be wrapped
+     * @param executor executor of the continuations of the derived futures that are not ready
+     * @return ready future with value
+     */
+    static Future<ErrorType, ValueType> Ok(ValueType value, executor::Executor& executor = executor::inlineExecutor()) {
+        return Ready(ResultType::Ok(std::move(value)), executor);
+    }
+
+    /**
+     * Constructs a ready Future holding an error
+     * @param error error to be wrapped
+     * @param executor executor of the continuations of the derived futures that are not ready
+     * @return ready future with error
+     */
+    static Future<ErrorType, ValueType> Error(ErrorType error, executor::Executor& executor = executor::inlineExecutor()) {
+        return Ready(ResultType::Error(std::move(error)), executor);
+    }
+
+    /**
+     * Checks whether the result is available, without blocking
+     * @return true if ready and false otherwise
+     */
+    [[nodiscard]] bool isReady() const { return _state->isReady(); }
+
+    /**
+     * Blocks until the result is available
+     */
+    void wait() const { _state->wait(); }
+
+    /**
+     * Blocks until the result is available and returns it
+     * @return the result, valid while any future or promise of the same state is alive
+     * @throws the exception thrown by the callable that produced the result, if any
+     */
+    [[nodiscard]] const ResultType& get() const {
+        _state->wait();
+        return _state->result();
+    }
+
+    /**
+     * Executor running the continuations of this future
+     * @return executor
+     */
+    [[nodiscard]] executor::Executor& executor() const { return _state->executor(); }
+
+private:
+    explicit Future(std::shared_ptr<State> state) : _state{std::move(state)} {}
+
+    template <typename Callable>
+    decltype(auto) internal_fmap(Callable&& callable) const {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, const ValueType&>, "Input argument is not invocable");
+        using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, const ValueType&>>;
+        static_assert(!std::is_void_v<ReturnType>, "Callable cannot return void");
+
+        Promise<ErrorType, ReturnType> promise(executor());
+        auto next = promise.future();
+        _state->then([promise, callable = std::forward<Callable>(callable)](const State& state) mutable {
+            future::details::settle(promise, [&state, &callable]() { return state.result().fmap(callable); });
+        });
+        return next;
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_bind(Callable&& callable) const {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, const ValueType&>, "Input argument is not invocable");
+        using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, const ValueType&>>;
+        static_assert(type::DomainTypeInfo<ReturnType>::hasMonadicBase, "Callable has to return a Future or an Either");
+        static_assert(std::is_same_v<ErrorType, typename type::DomainTypeInfo<ReturnType>::ErrorType>, "Error type does not match");
+        using InnerTypeOK = typename type::DomainTypeInfo<ReturnType>::ValueType;
+
+        Promise<ErrorType, InnerTypeOK> promise(executor());
+        auto next = promise.future();
+        _state->then([promise, callable = std::forward<Callable>(callable), &scheduler = executor()](const State& state) mutable {
+            try {
+                continueWith<ReturnType>(state.result(), callable, scheduler)._state->then([promise](const auto& inner) mutable {
+                    future::details::settle(promise, [&inner]() { return inner.result(); });
+                });
+            } catch (...) {
+                promise.setException(std::current_exception());
+            }
+        });
+        return next;
+    }
+
+    template <typename ReturnType, typename Callable>
+    static Future<ErrorType, typename type::DomainTypeInfo<ReturnType>::ValueType>
+    continueWith(const ResultType& result, Callable& callable, executor::Executor& executor) {
+        using Next = Future<ErrorType, typename type::DomainTypeInfo<ReturnType>::ValueType>;
+        if (!result.isOk()) {
+            return Next::Error(result.error_ref(), executor);
+        }
+        if constexpr (type::IsAsync<ReturnType>::value) {
+            return function::invoke(callable, result.value_ref());
+        } else {
+            return Next::Ready(function::invoke(callable, result.value_ref()), executor);
+        }
+    }
+
+    template <typename Arg>
+    decltype(auto) internal_apply(Arg&& arg) const {
+        static_assert(!std::is_invocable_v<std::decay_t<ValueType>>, "Function that takes 0 arguments cannot be called with arguments");
+        using ArgType = std::decay_t<Arg>;
+        if constexpr (type::IsAsync<ArgType>::value) {
+            return internal_bind([arg = std::forward<Arg>(arg)](const ValueType& callable) {
+                return arg.fmap([callable](const auto& value) { return applyFirst(callable, value); });
+            });
+        } else if constexpr (type::DomainTypeInfo<ArgType>::hasMonadicBase) {
+            using ArgInnerType = typename type::DomainTypeInfo<ArgType>::ValueType;
+            return internal_apply(Future<ErrorType, ArgInnerType>::Ready(std::forward<Arg>(arg), executor()));
+        } else {
+            return internal_fmap([arg = std::forward<Arg>(arg)](const ValueType& callable) { return applyFirst(callable, arg); });
+        }
+    }
+
+    decltype(auto) internal_apply() const {
+        static_assert(std::is_invocable_v<std::decay_t<ValueType>>, "Function that takes one or more arguments cannot be called without arguments");
+        return internal_fmap([](const ValueType& callable) { return std::invoke(callable); });
+    }
+
+    template <typename Arg>
+    static decltype(auto) applyFirst(const ValueType& callable, const Arg& arg) {
+        if constexpr (std::is_invocable_v<const ValueType&, const Arg&>) {
+            return std::invoke(callable, arg);
+        } else {
+            using PartialFunctionType = std::remove_reference_t<typename function::Info<ValueType>::PartialApplyFirst>;
+            return PartialFunctionType([callable, first = arg](auto&& ...args) {
+                return std::invoke(callable, first, std::forward<decltype(args)>(args)...);
+            });
+        }
+    }
+
+    std::shared_ptr<State> _state;
+};
+
+namespace future {
+
+/**
+ * @ingroup Future
+ *
+ * Runs given callable on the executor and returns a Future with its result
+ * @tparam Callable callable type, taking no arguments and returning an Either
+ * @param executor executor running the callable and the continuations of the returned future
+ * @param callable work to run asynchronously
+ * @return future completed with the result of the callable, or with the exception it throws
+ */
+template <typename Callable>
+decltype(auto) async(executor::Executor& executor, Callable&& callable) {
+    static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Callable cannot take arguments");
+    using ResultType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>>>;
+    static_assert(type::DomainTypeInfo<ResultType>::hasMonadicBase && !type::IsAsync<ResultType>::value, "Callable has to return an Either");
+    using ErrorType = typename type::DomainTypeInfo<ResultType>::ErrorType;
+    using ValueType = typename type::DomainTypeInfo<ResultType>::ValueType;
+
+    Promise<ErrorType, ValueType> promise(executor);
+    auto result = promise.future();
+    executor.execute([promise, callable = std::forward<Callable>(callable)]() mutable {
+        details::settle(promise, [&callable]() { return function::invoke(callable); });
+    });
+    return result;
+}
+
+} // namespace future
+} // namespace yafl
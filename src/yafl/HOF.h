@@ -10,6 +10,11 @@
 
 #include "yafl/TypeTraits.h"
 #include "yafl/Monad.h"
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace yafl {
 
@@ -25,7 +30,7 @@ namespace yafl {
  * @return true if all arguments verify the predicate and false otherwise
  */
 template<typename Predicate, typename ...Args>
-decltype(auto) all(Predicate&& predicate, Args&& ...args) {
+constexpr decltype(auto) all(Predicate&& predicate, Args&& ...args) {
     return (predicate(std::forward<Args>(args)) && ...);
 }
 
@@ -41,7 +46,7 @@ decltype(auto) all(Predicate&& predicate, Args&& ...args) {
  * @return true if any arguments verify the predicate and false otherwise
  */
 template<typename Predicate, typename ...Args>
-decltype(auto) any(Predicate&& predicate, Args&& ...args) {
+constexpr decltype(auto) any(Predicate&& predicate, Args&& ...args) {
     return (predicate(std::forward<Args>(args)) || ...);
 }
 
@@ -57,7 +62,7 @@ decltype(auto) any(Predicate&& predicate, Args&& ...args) {
  * @return function composed by executing rhs after lhs
  */
 template <typename TLeft, typename TRight>
-decltype(auto) function_compose(TLeft&& lhs, TRight&& rhs) {
+constexpr decltype(auto) function_compose(TLeft&& lhs, TRight&& rhs) {
     using LhsReturnType = typename function::Info<TLeft>::ReturnType;
     if constexpr (std::is_invocable_v<TLeft>) {
         if constexpr (std::is_void_v<LhsReturnType>) {
@@ -85,6 +90,40 @@ decltype(auto) function_compose(TLeft&& lhs, TRight&& rhs) {
     }
 }
 
+namespace details {
+/**
+ * @ingroup Details
+ *
+ * Callable information of a kleisli stage that receives the given Monad. The value held by the
+ * Monad is the context used to inspect generic stages, e.g, [](const auto& value) {...}
+ * @tparam Stage stage type
+ * @tparam Monad type of the monadic value the stage receives
+ */
+template <typename Stage, typename Monad, typename Value = typename type::DomainTypeInfo<Monad>::ValueType>
+struct StageInfo : function::Info<Stage, Value> {};
+
+template <typename Stage, typename Monad>
+struct StageInfo<Stage, Monad, void> : function::Info<Stage> {};
+
+/**
+ * @ingroup Details
+ *
+ * Result of running the given stages one after the other, starting with Current
+ * @tparam Current result of the previous stage
+ * @tparam Stages remaining stages
+ */
+template <typename Current, typename ...Stages>
+struct ChainResult {
+    using Type = Current;
+};
+
+template <typename Current, typename Stage, typename ...Stages>
+struct ChainResult<Current, Stage, Stages...> : ChainResult<typename StageInfo<Stage, Current>::ReturnType, Stages...> {};
+
+template <typename FirstStage, typename ...Stages>
+struct PipelineResult : ChainResult<typename function::Info<FirstStage>::ReturnType, Stages...> {};
+} // namespace details
+
 /**
  * @ingroup HOF
  *
@@ -97,32 +136,44 @@ decltype(auto) function_compose(TLeft&& lhs, TRight&& rhs) {
  * @return function composed by executing rhs after lhs
  */
 template <typename TLeft, typename TRight>
-decltype(auto) kleisli_compose(TLeft&& lhs, TRight&& rhs) {
-    using FirstArg = typename function::Info<TLeft>::template ArgType<0>;
-    using RhsReturnType = typename function::Info<TRight>::ReturnType;
+constexpr decltype(auto) kleisli_compose(TLeft&& lhs, TRight&& rhs) {
+    using FirstArg = std::tuple_element_t<0, typename function::Info<TLeft>::DeclaredArgTypes>;
+    using RhsInfo = details::StageInfo<TRight, typename function::Info<TLeft>::ReturnType>;
+    using RhsReturnType = typename RhsInfo::ReturnType;
     static_assert(type::DomainTypeInfo<RhsReturnType>::hasMonadicBase, "Right hand side needs to have Monadic base");
 
-    return [rhs = std::forward<TRight>(rhs), lhs = std::forward<TLeft>(lhs)](const FirstArg& arg) -> RhsReturnType {
-        using LhsReturnType = typename function::Info<TLeft>::ReturnType;
-        const LhsReturnType intermediate_result = lhs(arg);
-
-        if constexpr (std::is_void_v<typename type::DomainTypeInfo<LhsReturnType>::ValueType>) {
-            if (!intermediate_result) {
-                return type::DomainTypeInfo<RhsReturnType>::handleError(intermediate_result);
+    if constexpr (type::IsAsync<typename function::Info<TLeft>::ReturnType>::value) {
+        // the intermediate result may not be available yet, chain rhs as a continuation instead of inspecting it
+        return [rhs = std::forward<TRight>(rhs), lhs = std::forward<TLeft>(lhs)](FirstArg arg) {
+            if constexpr (type::DomainTypeInfo<typename RhsInfo::template ArgType<0>>::hasMonadicBase) {
+                return rhs(lhs(std::forward<FirstArg>(arg)));
             } else {
-                return rhs();
+                return lhs(std::forward<FirstArg>(arg)).bind(rhs);
             }
-        } else {
-            if constexpr (type::DomainTypeInfo<typename function::Info<TRight>::template ArgType<0>>::hasMonadicBase) {
-                return rhs(intermediate_result);
-            } else {
+        };
+    } else {
+        return [rhs = std::forward<TRight>(rhs), lhs = std::forward<TLeft>(lhs)](FirstArg arg) -> RhsReturnType {
+            using LhsReturnType = typename function::Info<TLeft>::ReturnType;
+            LhsReturnType intermediate_result = lhs(std::forward<FirstArg>(arg));
+
+            if constexpr (std::is_void_v<typename type::DomainTypeInfo<LhsReturnType>::ValueType>) {
                 if (!intermediate_result) {
                     return type::DomainTypeInfo<RhsReturnType>::handleError(intermediate_result);
+                } else {
+                    return rhs();
+                }
+            } else {
+                if constexpr (type::DomainTypeInfo<typename RhsInfo::template ArgType<0>>::hasMonadicBase) {
+                    return rhs(std::move(intermediate_result));
+                } else {
+                    if (!intermediate_result) {
+                        return type::DomainTypeInfo<RhsReturnType>::handleError(intermediate_result);
+                    }
+                    return rhs(std::move(intermediate_result).value());
                 }
-                return rhs(intermediate_result.value());
             }
-        }
-    };
+        };
+    }
 }
 
 /**
@@ -136,7 +187,7 @@ decltype(auto) kleisli_compose(TLeft&& lhs, TRight&& rhs) {
  * @return function composed by executing rhs after lhs
  */
 template <typename TLeft, typename TRight>
-decltype(auto) compose(TLeft&& lhs, TRight&& rhs) {
+constexpr decltype(auto) compose(TLeft&& lhs, TRight&& rhs) {
     using LhsReturnType = typename function::Info<TLeft>::ReturnType;
     if constexpr (type::DomainTypeInfo<LhsReturnType>::hasMonadicBase) {
         return kleisli_compose(std::forward<TLeft>(lhs), std::forward<TRight>(rhs));
@@ -145,10 +196,137 @@ decltype(auto) compose(TLeft&& lhs, TRight&& rhs) {
     }
 }
 
+/**
+ * @ingroup HOF
+ *
+ * Kleisli composition of N functions that return Monadic values, stored in a flat tuple.
+ * Equivalent to compose(compose(compose(f1, f2), ...), fn), but stages are executed one after
+ * the other without nesting: each intermediate result is moved into the next stage and the
+ * first Nothing/Error returns immediately, skipping all remaining stages.
+ * @tparam Stages types of the functions to compose
+ */
+template <typename ...Stages>
+class Pipeline {
+    static_assert(sizeof...(Stages) > 0, "Pipeline needs at least one stage");
+
+    using StagesTuple = std::tuple<Stages...>;
+    using FirstStage = std::tuple_element_t<0, StagesTuple>;
+    using FirstArg = std::tuple_element_t<0, typename function::Info<FirstStage>::DeclaredArgTypes>;
+    using ReturnType = typename details::PipelineResult<Stages...>::Type;
+
+    static_assert(type::DomainTypeInfo<ReturnType>::hasMonadicBase, "Last stage needs to have Monadic base");
+
+public:
+    /**
+     * Constructor
+     * @param stages functions to compose, in order of execution
+     */
+    constexpr explicit Pipeline(Stages ...stages) : _stages{std::move(stages)...} {}
+
+    /**
+     * Executes all stages with given argument
+     * @param arg input argument of the first stage
+     * @return result of the last stage or the first Nothing/Error produced
+     */
+    constexpr ReturnType operator()(FirstArg arg) const {
+        return run<1>(std::get<0>(_stages)(std::forward<FirstArg>(arg)));
+    }
+
+private:
+    template <std::size_t Index, typename Current>
+    constexpr ReturnType run(Current&& current) const {
+        if constexpr (Index == sizeof...(Stages)) {
+            return std::forward<Current>(current);
+        } else {
+            using Stage = std::tuple_element_t<Index, StagesTuple>;
+            using CurrentInfo = type::DomainTypeInfo<Current>;
+            static_assert(CurrentInfo::hasMonadicBase, "Intermediate stages need to have Monadic base");
+
+            const auto& stage = std::get<Index>(_stages);
+            if constexpr (std::is_void_v<typename CurrentInfo::ValueType>) {
+                if (!current) {
+                    return type::DomainTypeInfo<ReturnType>::handleError(current);
+                }
+                return run<Index + 1>(stage());
+            } else if constexpr (type::DomainTypeInfo<typename details::StageInfo<Stage, std::decay_t<Current>>::template ArgType<0>>::hasMonadicBase) {
+                return run<Index + 1>(stage(std::forward<Current>(current)));
+            } else {
+                if (!current) {
+                    return type::DomainTypeInfo<ReturnType>::handleError(current);
+                }
+                return run<Index + 1>(stage(*std::forward<Current>(current)));
+            }
+        }
+    }
+
+    StagesTuple _stages;
+};
+
+/**
+ * @ingroup HOF
+ *
+ * Kleisli composition of given functions into a flat Pipeline.
+ * pipeline(f1, f2, f3) behaves as compose(compose(f1, f2), f3).
+ * @tparam Stages types of the functions to compose
+ * @param stages functions to compose, in order of execution
+ * @return Pipeline that executes all stages
+ */
+template <typename ...Stages>
+constexpr decltype(auto) pipeline(Stages&& ...stages) {
+    return Pipeline<std::decay_t<Stages>...>(std::forward<Stages>(stages)...);
+}
+
+template <typename Callable>
+decltype(auto) curry(Callable&& callable);
+
+namespace {
+    template<typename Callable, typename FirstArg>
+    decltype(auto) curry_first(Callable callable, FirstArg arg) {
+        using ReturnType = typename function::Info<Callable>::ReturnType;
+        using RemainingArgsTuple = typename function::Info<Callable>::PartialApplyFirstArgTypes;
+        using DeclaredArgsTuple = typename function::Info<Callable>::DeclaredArgTypes;
+
+        return function::make_closure<ReturnType, RemainingArgsTuple>(
+                function::BoundCall<Callable, DeclaredArgsTuple, FirstArg>(std::move(callable), std::move(arg)));
+    }
+
+    /**
+     * Step of a curried function: takes the first argument of the callable and returns the
+     * callable curried over the remaining ones. Applying an rvalue step moves the callable,
+     * and the arguments bound so far, into the next step instead of copying them.
+     * @tparam Callable decayed callable type
+     */
+    template<typename Callable>
+    class CurryStep {
+        using FirstArg = typename function::Info<Callable>::template ArgType<0>;
+        using ResultType = decltype(curry(curry_first(std::declval<Callable>(), std::declval<FirstArg>())));
+
+    public:
+        using CallSignature = function::details::CallableDetails<ResultType, FirstArg>;
+
+        explicit CurryStep(Callable callable) : _callable{std::move(callable)} {}
+
+        ResultType operator()(FirstArg arg) const& {
+            static_assert(std::is_copy_constructible_v<Callable>, "Curried move-only callables can only be applied as rvalues");
+            return curry(curry_first(Callable(_callable), std::move(arg)));
+        }
+
+        ResultType operator()(FirstArg arg) && {
+            return curry(curry_first(std::move(_callable), std::move(arg)));
+        }
+
+    private:
+        Callable _callable;
+    };
+} // end namespace
+
 /**
  * @ingroup HOF
  *
  * Curry given callable.
+ * Applying a curried function as an rvalue, e.g, curry(f)(a)(b), moves the arguments bound so far
+ * along instead of copying them. If the callable is move-only, the curried function can only be
+ * applied as an rvalue.
  * @tparam Callable type of callable
  * @param callable function to execute
  * @return curried function
@@ -156,18 +334,9 @@ decltype(auto) compose(TLeft&& lhs, TRight&& rhs) {
 template <typename Callable>
 decltype(auto) curry(Callable&& callable) {
     if constexpr (std::is_invocable_v<std::decay_t<Callable>>) {
-        return callable();
+        return std::forward<Callable>(callable)();
     } else {
-        using FirstArg = typename function::Info<Callable>::template ArgType<0>;
-        return [callable = std::forward<Callable>(callable)](const FirstArg& arg) {
-            using ReturnFunType = typename function::Info<Callable>::PartialApplyFirst;
-
-            const ReturnFunType inner_func = [callable, arg = std::move(arg)](auto&& ...args) {
-                return callable(std::move(arg), std::forward<decltype(args)>(args)...);
-            };
-
-            return curry(std::move(inner_func));
-        };
+        return CurryStep<std::decay_t<Callable>>(std::forward<Callable>(callable));
     }
 }
 
@@ -179,8 +348,8 @@ namespace {
 
     template<typename Callable, typename Head, typename ...Tail>
     decltype(auto) uncurry_impl(Callable&& callable, Head&& value, Tail&&...ts) {
-        const auto result = callable(std::forward<Head>(value));
-        return uncurry_impl(result, std::forward<Tail>(ts)...);
+        auto result = callable(std::forward<Head>(value));
+        return uncurry_impl(std::move(result), std::forward<Tail>(ts)...);
     }
 } // end namespace
 
@@ -203,6 +372,9 @@ decltype(auto) uncurry(Callable&& callable) {
  * @ingroup HOF
  *
  * Partial apply given function.
+ * Applying the returned function as an rvalue moves the bound arguments into the callable instead of copying them.
+ * Bound move-only arguments are moved into the callable, so the returned function can only be applied as an rvalue,
+ * unless the callable takes them by lvalue reference.
  * @tparam Callable type of callable
  * @tparam Args type of args
  * @param callable function to partial apply given arguments
@@ -219,16 +391,12 @@ decltype(auto) partial(Callable&& callable, Args&& ...args) {
     } else {
 
         using RemainingArgsTuple = tuple::TupleSubset<IsTupleSubset::index, typename function::Info<Callable>::ArgTypes>;
-        using ReturnType = function::FunctionFromTuple<typename function::Info<Callable>::ReturnType, RemainingArgsTuple>;
-
-        const ReturnType f = [callable = std::forward<Callable>(callable), vargs = std::make_tuple(std::forward<Args>(args)...)](auto&& ...inner_args) {
-            return std::apply([callable = std::move(callable)](auto&& ...apply_args){
-                                  return callable(std::forward<decltype(apply_args)>(apply_args)...);
-                              },
-                              std::tuple_cat(vargs, std::make_tuple(inner_args...)));
-        };
+        using ReturnType = typename function::Info<Callable>::ReturnType;
+        using DeclaredArgsTuple = typename function::Info<Callable>::DeclaredArgTypes;
 
-        return f;
+        return function::make_closure<ReturnType, RemainingArgsTuple>(
+                function::BoundCall<std::decay_t<Callable>, DeclaredArgsTuple, std::decay_t<Args>...>(
+                        std::forward<Callable>(callable), std::forward<Args>(args)...));
     }
 }
 
@@ -241,7 +409,7 @@ decltype(auto) partial(Callable&& callable, Args&& ...args) {
  * @return argument
  */
 template<typename Arg>
-Arg id(Arg&& arg) {
+constexpr Arg id(Arg&& arg) {
     return std::forward<Arg>(arg);
 }
 
@@ -254,7 +422,7 @@ Arg id(Arg&& arg) {
  * @return Returns a function that always returns the configured first argument
  */
 template<typename First>
-decltype(auto) constf(First&& first) {
+constexpr decltype(auto) constf(First&& first) {
     return [first = std::forward<First>(first)](auto&& ...) {
         return first;
     };
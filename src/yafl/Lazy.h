@@ -0,0 +1,350 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Lazy Lazy
+ */
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "yafl/Applicative.h"
+#include "yafl/Functor.h"
+#include "yafl/Monad.h"
+#include "yafl/TypeTraits.h"
+
+namespace yafl {
+
+/**
+ * @ingroup Lazy
+ *
+ * Memoizing thunk: a value whose computation is deferred until it is first forced.
+ * The computation runs at most once, even when many threads force the value concurrently,
+ * and every later force returns the memoized value. fmap, bind and apply only build new
+ * thunks, so a lazy chain evaluates nothing until its end is forced, and then each step once.
+ *
+ * Lazies are cheap handles to a shared state: copies share the memoized value. A Lazy<Maybe<T>>
+ * or Lazy<Either<E, T>> memoizes Nothing/Error like any other value, see lazy::then.
+ */
+template <typename T>
+class Lazy;
+
+namespace type {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * Lazy traits specialization that enable getting the inner type
+ * @tparam Inner Inner type
+ */
+template<typename Inner>
+struct DomainDetailsImpl<Lazy<Inner>> {
+    /// Functor Base type
+    using FBaseType = core::Functor<Lazy, Inner>;
+    /// Applicative Base type
+    using ABaseType = core::Applicative<Lazy, Inner>;
+    /// Monad Base type
+    using MBaseType = core::Monad<Lazy, Inner>;
+    /// Value Type
+    using ValueType = Inner;
+    /// Derived type
+    using DerivedType = Lazy<Inner>;
+    ///boolean flag that states whether type T is a Functor or not
+    static constexpr bool hasFunctorBase = std::is_base_of_v<FBaseType, DerivedType>;
+    ///boolean flag that states whether type T is an Applicative or not
+    static constexpr bool hasApplicativeBase = std::is_base_of_v<ABaseType, DerivedType>;
+    ///boolean flag that states whether type T is a Monad or not
+    static constexpr bool hasMonadicBase = std::is_base_of_v<MBaseType, DerivedType>;
+    ///boolean flag that states that the value of T has to be chained, not inspected
+    static constexpr bool isAsync = true;
+    ///Callback responsible for wrapping a value into the Derived type
+    static constexpr auto wrapValue = [](auto&& value) {
+        return DerivedType::Ready(std::forward<decltype(value)>(value));
+    };
+    /// Same monad holding another value type
+    template<typename T>
+    using RebindType = Lazy<T>;
+};
+} // namespace details
+} // namespace type
+
+namespace lazy {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * Checks whether T is a Lazy
+ * @tparam T type to check
+ */
+template <typename T>
+struct IsLazy : std::false_type {};
+
+template <typename T>
+struct IsLazy<Lazy<T>> : std::true_type {};
+
+/**
+ * @ingroup Details
+ *
+ * State shared by the copies of a Lazy: the memoized value, or the thunk computing it
+ */
+template <typename T>
+class State {
+public:
+    State() = default;
+
+    explicit State(T value) : _value{std::move(value)}, _evaluated{true} {}
+
+    State(const State&) = delete;
+    State& operator=(const State&) = delete;
+
+    virtual ~State() = default;
+
+    /**
+     * Evaluates the thunk on first use, concurrent callers wait for that single evaluation.
+     * If the thunk throws, the exception propagates and the next force evaluates it again
+     * @return memoized value
+     */
+    const T& force() {
+        // std::call_once is avoided on purpose, some implementations deadlock when the callable throws
+        if (!_evaluated.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_evaluated.load(std::memory_order_relaxed)) {
+                _value.emplace(evaluate());
+                release();
+                _evaluated.store(true, std::memory_order_release);
+            }
+        }
+        return *_value;
+    }
+
+    [[nodiscard]] bool isEvaluated() const {
+        return _evaluated.load(std::memory_order_acquire);
+    }
+
+protected:
+    /// Computes the value
+    virtual T evaluate() = 0;
+
+    /// Drops the thunk and whatever it captured, e.g, upstream lazies, once the value is memoized
+    virtual void release() = 0;
+
+private:
+    std::mutex _mutex;
+    std::optional<T> _value;
+    std::atomic<bool> _evaluated{false};
+};
+
+/**
+ * @ingroup Details
+ *
+ * State of an already evaluated Lazy
+ */
+template <typename T>
+class ReadyState final : public State<T> {
+public:
+    explicit ReadyState(T value) : State<T>(std::move(value)) {}
+
+protected:
+    // never called, the state is created evaluated
+    T evaluate() override { return this->force(); }
+
+    void release() override {}
+};
+
+/**
+ * @ingroup Details
+ *
+ * State of a deferred Lazy, the thunk is stored inline so that each Lazy costs a single allocation
+ */
+template <typename T, typename Callable>
+class ThunkState final : public State<T> {
+public:
+    explicit ThunkState(Callable callable) : _callable{std::move(callable)} {}
+
+protected:
+    T evaluate() override { return function::invoke(*_callable); }
+
+    void release() override { _callable.reset(); }
+
+private:
+    std::optional<Callable> _callable;
+};
+
+} // namespace details
+} // namespace lazy
+
+template <typename T>
+class Lazy : public core::Functor<Lazy, T>
+           , public core::Applicative<Lazy, T>
+           , public core::Monad<Lazy, T> {
+    friend class core::Functor<Lazy, T>;
+    friend class core::Applicative<Lazy, T>;
+    friend class core::Monad<Lazy, T>;
+
+    template <typename> friend class Lazy;
+
+    static_assert(!std::is_reference_v<T> && !std::is_void_v<T>, "Lazy class cannot hold references or void values");
+
+    using State = lazy::details::State<T>;
+
+public:
+    /**
+     * Constructs a Lazy whose value is computed by the callable the first time it is forced
+     * @tparam Callable callable type, taking no arguments and returning T
+     * @param callable thunk computing the value
+     * @return deferred lazy
+     */
+    template <typename Callable>
+    static Lazy<T> Defer(Callable&& callable) {
+        static_assert(std::is_invocable_r_v<T, std::decay_t<Callable>&>, "Callable has to take no arguments and return the Lazy value type");
+        using Thunk = lazy::details::ThunkState<T, std::decay_t<Callable>>;
+        return Lazy<T>(std::make_shared<Thunk>(std::forward<Callable>(callable)));
+    }
+
+    /**
+     * Constructs an already evaluated Lazy
+     * @param value value to be wrapped
+     * @return evaluated lazy
+     */
+    static Lazy<T> Ready(T value) {
+        return Lazy<T>(std::make_shared<lazy::details::ReadyState<T>>(std::move(value)));
+    }
+
+    /**
+     * Forces the evaluation, at most once for all copies of this Lazy, and returns the value
+     * @return the memoized value, valid while any copy of this Lazy is alive
+     */
+    [[nodiscard]] const T& get() const { return _state->force(); }
+
+    /**
+     * Checks whether the value was already computed, without forcing it
+     * @return true if evaluated and false otherwise
+     */
+    [[nodiscard]] bool isEvaluated() const { return _state->isEvaluated(); }
+
+private:
+    explicit Lazy(std::shared_ptr<State> state) : _state{std::move(state)} {}
+
+    template <typename Callable>
+    decltype(auto) internal_fmap(Callable&& callable) const {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, const T&>, "Input argument is not invocable");
+        using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, const T&>>;
+        static_assert(!std::is_void_v<ReturnType>, "Callable cannot return void");
+
+        return Lazy<ReturnType>::Defer([source = *this, callable = std::forward<Callable>(callable)]() {
+            return function::invoke(callable, source.get());
+        });
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_bind(Callable&& callable) const {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, const T&>, "Input argument is not invocable");
+        using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, const T&>>;
+        static_assert(lazy::details::IsLazy<ReturnType>::value, "Callable has to return a Lazy");
+        using InnerType = typename type::DomainTypeInfo<ReturnType>::ValueType;
+
+        return Lazy<InnerType>::Defer([source = *this, callable = std::forward<Callable>(callable)]() {
+            return function::invoke(callable, source.get()).get();
+        });
+    }
+
+    template <typename Arg>
+    decltype(auto) internal_apply(Arg&& arg) const {
+        static_assert(!std::is_invocable_v<std::decay_t<T>>, "Function that takes 0 arguments cannot be called with arguments");
+        using ArgType = std::decay_t<Arg>;
+        if constexpr (type::IsAsync<ArgType>::value) {
+            return internal_bind([arg = std::forward<Arg>(arg)](const T& callable) {
+                return arg.fmap([callable](const auto& value) { return applyFirst(callable, value); });
+            });
+        } else {
+            return internal_fmap([arg = std::forward<Arg>(arg)](const T& callable) { return applyFirst(callable, arg); });
+        }
+    }
+
+    decltype(auto) internal_apply() const {
+        static_assert(std::is_invocable_v<std::decay_t<T>>, "Function that takes one or more arguments cannot be called without arguments");
+        return internal_fmap([](const T& callable) { return std::invoke(callable); });
+    }
+
+    template <typename Arg>
+    static decltype(auto) applyFirst(const T& callable, const Arg& arg) {
+        if constexpr (std::is_invocable_v<const T&, const Arg&>) {
+            return std::invoke(callable, arg);
+        } else {
+            using PartialFunctionType = std::remove_reference_t<typename function::Info<T>::PartialApplyFirst>;
+            return PartialFunctionType([callable, first = arg](auto&& ...args) {
+                return std::invoke(callable, first, std::forward<decltype(args)>(args)...);
+            });
+        }
+    }
+
+    std::shared_ptr<State> _state;
+};
+
+namespace lazy {
+
+/**
+ * @ingroup Lazy
+ *
+ * Function that helps build a deferred Lazy, the value type is deduced from the callable
+ * @tparam Callable callable type, taking no arguments
+ * @param callable thunk computing the value
+ * @return deferred lazy
+ */
+template <typename Callable>
+decltype(auto) Defer(Callable&& callable) {
+    static_assert(std::is_invocable_v<std::decay_t<Callable>&>, "Callable cannot take arguments");
+    using ValueType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>&>>;
+    return Lazy<ValueType>::Defer(std::forward<Callable>(callable));
+}
+
+/**
+ * @ingroup Lazy
+ *
+ * Function that helps build an already evaluated Lazy
+ * @tparam ValueType value type
+ * @param value value to be wrapped
+ * @return evaluated lazy
+ */
+template <typename ValueType>
+Lazy<std::decay_t<ValueType>> Ready(ValueType&& value) {
+    return Lazy<std::decay_t<ValueType>>::Ready(std::forward<ValueType>(value));
+}
+
+/**
+ * @ingroup Lazy
+ *
+ * Chains a step over the value inside a Lazy<Maybe<T>> or Lazy<Either<E, T>>. The step only runs if
+ * the upstream result holds a value, a Nothing/Error is propagated instead. Either way, the outcome is
+ * memoized, so a failing step is neither recomputed nor re-reported on later forces.
+ * @tparam Monad Maybe or Either type wrapped by the Lazy
+ * @tparam Callable callable type, taking the inner value and returning a plain value or a Maybe/Either
+ * @param source lazy result of the previous step
+ * @param callable next step
+ * @return lazy result of the next step
+ */
+template <typename Monad, typename Callable>
+decltype(auto) then(const Lazy<Monad>& source, Callable&& callable) {
+    static_assert(type::DomainTypeInfo<Monad>::hasMonadicBase, "Lazy has to wrap a Maybe or an Either");
+    using InnerType = typename type::DomainTypeInfo<Monad>::ValueType;
+    using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, const InnerType&>>;
+
+    return source.fmap([callable = std::forward<Callable>(callable)](const Monad& result) {
+        if constexpr (type::DomainTypeInfo<ReturnType>::hasMonadicBase) {
+            return result.bind(callable);
+        } else {
+            return result.fmap(callable);
+        }
+    });
+}
+
+} // namespace lazy
+} // namespace yafl
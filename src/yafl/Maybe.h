@@ -7,15 +7,18 @@
  */
 #pragma once
 
-#include <iostream>
-#include <memory>
-#include <optional>
 #include <functional>
+#include <optional>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <vector>
+#include "yafl/fwd.h"
 #include "yafl/Functor.h"
 #include "yafl/Applicative.h"
 #include "yafl/Monad.h"
 #include "yafl/TypeTraits.h"
+#include "yafl/Assert.h"
 
 namespace yafl {
 
@@ -60,6 +63,13 @@ struct DomainDetailsImpl<Maybe<Inner>> {
     static constexpr auto handleError = [](auto&& ...) {
         return DerivedType::Nothing();
     };
+    ///Callback responsible for wrapping a value into the Derived type
+    static constexpr auto wrapValue = [](auto&& value) {
+        return DerivedType::Just(std::forward<decltype(value)>(value));
+    };
+    /// Same monad holding another value type
+    template<typename T>
+    using RebindType = Maybe<T>;
 };
 } // namespace details
 } // namespace type
@@ -75,7 +85,7 @@ class Maybe<void> : public core::Functor<Maybe,void>,
     friend class core::Functor<Maybe,void>;
     friend class core::Monad<Maybe,void>;
 private:
-    explicit Maybe(bool v) : _value(v) {}
+    constexpr explicit Maybe(bool v) : _value(v) {}
 
 public:
     /**
@@ -109,7 +119,7 @@ public:
      * @param other instance of maybe to compare to
      * @return true if objects are equal and false otherwise
      */
-    bool operator==(const Maybe<void>& other) const noexcept {
+    constexpr bool operator==(const Maybe<void>& other) const noexcept {
         return _value == other._value;
     }
 
@@ -117,7 +127,7 @@ public:
      * Logical not operator
      * @return false if maybe has value and true otherwise
      */
-    bool operator!() const {
+    constexpr bool operator!() const {
         return !_value;
     }
 
@@ -125,7 +135,7 @@ public:
      * Constructs a Maybe type that has Nothing
      * @return maybe nothing
      */
-    static Maybe<void> Nothing() {
+    static constexpr Maybe<void> Nothing() {
         return Maybe<void>(false);
     }
 
@@ -135,7 +145,7 @@ public:
      * receive any argument
      * @return maybe with "void" value
      */
-    static Maybe<void> Just() {
+    static constexpr Maybe<void> Just() {
         return Maybe<void>{true};
     }
 
@@ -143,30 +153,30 @@ public:
      * Returns whether maybe has nothing or a valid value
      * @return true if valid and false otherwise
      */
-    [[nodiscard]] bool hasValue() const { return _value; }
+    [[nodiscard]] constexpr bool hasValue() const { return _value; }
 
 private:
     template <typename Callable>
-    decltype(auto) internal_bind(Callable&& callable) const {
+    constexpr decltype(auto) internal_bind(Callable&& callable) const {
         static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
         if (hasValue()) {
-            return std::invoke<Callable>(std::forward<Callable>(callable));
+            return function::invoke(std::forward<Callable>(callable));
         } else {
             return ReturnType::Nothing();
         }
     }
 
     template <typename Callable>
-    decltype(auto) internal_fmap(Callable&& callable) const {
+    constexpr decltype(auto) internal_fmap(Callable&& callable) const {
         static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
         if (hasValue()) {
             if constexpr (std::is_void_v<ReturnType>) {
-                std::invoke<Callable>(std::forward<Callable>(callable));
+                function::invoke(std::forward<Callable>(callable));
                 return Maybe<void>::Just();
             } else {
-                return Maybe<ReturnType>::Just(std::invoke<Callable>(std::forward<Callable>(callable)));
+                return Maybe<ReturnType>::Just(function::invoke(std::forward<Callable>(callable)));
             }
         } else {
             return Maybe<ReturnType>::Nothing();
@@ -192,8 +202,12 @@ class Maybe : public core::Functor<Maybe, T>,
     static_assert(!std::is_reference_v<T>, "Maybe class cannot store reference to value");
 
 private:
-    Maybe() : _value{}{}
-    explicit Maybe(const T& value) : _value{value}{}
+    constexpr Maybe() : _value{}{}
+    constexpr explicit Maybe(const T& value) : _value{value}{}
+    constexpr explicit Maybe(T&& value) : _value{std::move(value)}{}
+
+    template <typename ...Args>
+    constexpr explicit Maybe(std::in_place_t, Args&& ...args) : _value{std::in_place, std::forward<Args>(args)...}{}
 public:
     /**
      * Copy constructor
@@ -226,7 +240,7 @@ public:
      * @param other instance of maybe to compare to
      * @return true if objects are equal and false otherwise
      */
-    bool operator==(const Maybe<T>& other) const noexcept {
+    constexpr bool operator==(const Maybe<T>& other) const noexcept {
         return  _value == other._value;
     }
 
@@ -234,7 +248,7 @@ public:
      * Logical not operator
      * @return false if maybe has value and true otherwise
      */
-    bool operator!() const {
+    constexpr bool operator!() const {
         return !hasValue();
     }
 
@@ -242,7 +256,7 @@ public:
      * Constructs a Maybe type that has Nothing
      * @return maybe nothing
      */
-    static Maybe<T> Nothing() {
+    static constexpr Maybe<T> Nothing() {
         return Maybe<T>();
     }
 
@@ -253,57 +267,197 @@ public:
      * @param value
      * @return maybe with "void" value
      */
-    static Maybe<T> Just(const T& value) {
+    static constexpr Maybe<T> Just(const T& value) {
         return Maybe<T>(value);
     }
 
+    /**
+     * Constructs a Maybe type with a "valid" value.
+     * The given value is moved into the Maybe
+     * @param value
+     * @return maybe with the value moved
+     */
+    static constexpr Maybe<T> Just(T&& value) {
+        return Maybe<T>(std::move(value));
+    }
+
+    /**
+     * Constructs a Maybe type with a "valid" value.
+     * The value is constructed in place from the given arguments,
+     * avoiding any temporary copy or move
+     * @param args arguments forwarded to the constructor of T
+     * @return maybe with the value constructed in place
+     */
+    template <typename ...Args>
+    static constexpr Maybe<T> Just(std::in_place_t, Args&& ...args) {
+        return Maybe<T>(std::in_place, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Destroys the current value (if any) and constructs a new one in place
+     * from the given arguments
+     * @param args arguments forwarded to the constructor of T
+     * @return reference to the new value
+     */
+    template <typename ...Args>
+    T& emplace(Args&& ...args) {
+        return _value.emplace(std::forward<Args>(args)...);
+    }
+
     /**
      * Checks whether maybe has nothing or a valid value
      * @return true if valid and false otherwise
      */
-    [[nodiscard]] bool hasValue() const { return _value.has_value(); }
+    [[nodiscard]] constexpr bool hasValue() const { return _value.has_value(); }
 
     /**
      * Extracts the wrapped value from the Maybe
      * @return the value wrapped
      * @throws std::runtime_error when maybe contains nothing
      */
-    [[nodiscard]] T value() const {
+    [[nodiscard]] constexpr T value() const& {
         if (_value) return _value.value();
         throw std::runtime_error("Nothing");
     }
 
+    /**
+     * Extracts the wrapped value from the Maybe by moving it out
+     * @return the value wrapped
+     * @throws std::runtime_error when maybe contains nothing
+     */
+    [[nodiscard]] constexpr T value() && {
+        if (_value) return std::move(_value).value();
+        throw std::runtime_error("Nothing");
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return const reference to the wrapped value
+     */
+    [[nodiscard]] constexpr const T& value_ref() const& {
+        YAFL_ASSERT(hasValue(), "value_ref() called without value");
+        return *_value;
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return reference to the wrapped value
+     */
+    constexpr const T& operator*() const& {
+        YAFL_ASSERT(hasValue(), "operator*() called without value");
+        return *_value;
+    }
+
+    /**
+     * Unchecked access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return reference to the wrapped value
+     */
+    constexpr T& operator*() & {
+        YAFL_ASSERT(hasValue(), "operator*() called without value");
+        return *_value;
+    }
+
+    /**
+     * Unchecked access to the wrapped value that allows moving it out.
+     * The value must exist, which is only asserted in debug builds
+     * @return rvalue reference to the wrapped value
+     */
+    constexpr T&& operator*() && {
+        YAFL_ASSERT(hasValue(), "operator*() called without value");
+        return std::move(*_value);
+    }
+
+    /**
+     * Unchecked member access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return pointer to the wrapped value
+     */
+    constexpr const T* operator->() const {
+        YAFL_ASSERT(hasValue(), "operator->() called without value");
+        return _value.operator->();
+    }
+
+    /**
+     * Unchecked member access to the wrapped value. The value must exist, which is
+     * only asserted in debug builds
+     * @return pointer to the wrapped value
+     */
+    constexpr T* operator->() {
+        YAFL_ASSERT(hasValue(), "operator->() called without value");
+        return _value.operator->();
+    }
+
     /**
      * Extracts the wrapped value from the Maybe if exists.
      * If Maybe contains nothing then returns provided default value
      * @param arg default value to return if Maybe contains nothing
      * @return the wrapped value if exists or the default otherwise
      */
-    [[nodiscard]] T valueOr(const T& arg) const {
-        return hasValue() ? value() : arg;
+    [[nodiscard]] constexpr T valueOr(const T& arg) const& {
+        return hasValue() ? *_value : arg;
+    }
+
+    /**
+     * Extracts the wrapped value from the Maybe by moving it out if exists.
+     * If Maybe contains nothing then returns provided default value
+     * @param arg default value to return if Maybe contains nothing
+     * @return the wrapped value if exists or the default otherwise
+     */
+    [[nodiscard]] constexpr T valueOr(T arg) && {
+        return hasValue() ? std::move(*_value) : std::move(arg);
     }
 private:
     template <typename Callable>
-    decltype(auto) internal_bind(Callable&& callable) const {
+    constexpr decltype(auto) internal_bind(Callable&& callable) const& {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<T>>, "Input argument is not invocable");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<T>>>;
+        if (hasValue()) {
+            return function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(*_value));
+        } else {
+            return ReturnType::Nothing();
+        }
+    }
+
+    template <typename Callable>
+    constexpr decltype(auto) internal_bind(Callable&& callable) && {
         static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<T>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<T>>>;
         if (hasValue()) {
-            return std::invoke<Callable>(std::forward<Callable>(callable), value());
+            return function::invoke(std::forward<Callable>(callable), std::move(*this).value());
         } else {
             return ReturnType::Nothing();
         }
     }
 
     template <typename Callable>
-    decltype(auto) internal_fmap(Callable&& callable) const {
+    constexpr decltype(auto) internal_fmap(Callable&& callable) const& {
         static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<T>>, "Input argument is not invocable");
         using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<T>>>;
         if (hasValue()) {
             if constexpr (std::is_void_v<ReturnType>) {
-                std::invoke<Callable>(std::forward<Callable>(callable), value());
+                function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(*_value));
                 return Maybe<ReturnType>::Just();
             } else {
-                return Maybe<ReturnType>::Just(std::invoke<Callable>(std::forward<Callable>(callable), value()));
+                return Maybe<ReturnType>::Just(function::invoke(std::forward<Callable>(callable), function::pass_stored<Callable>(*_value)));
+            }
+        } else {
+            return Maybe<ReturnType>::Nothing();
+        }
+    }
+
+    template <typename Callable>
+    constexpr decltype(auto) internal_fmap(Callable&& callable) && {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, std::decay_t<T>>, "Input argument is not invocable");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>, std::decay_t<T>>>;
+        if (hasValue()) {
+            if constexpr (std::is_void_v<ReturnType>) {
+                function::invoke(std::forward<Callable>(callable), std::move(*this).value());
+                return Maybe<ReturnType>::Just();
+            } else {
+                return Maybe<ReturnType>::Just(function::invoke(std::forward<Callable>(callable), std::move(*this).value()));
             }
         } else {
             return Maybe<ReturnType>::Nothing();
@@ -311,7 +465,7 @@ private:
     }
 
     template <typename Arg>
-    decltype(auto) internal_apply(Arg&& arg) const {
+    constexpr decltype(auto) internal_apply(Arg&& arg) const {
         static_assert(!std::is_invocable_v<std::decay_t<T>>, "Function that takes 0 arguments cannot be called with arguments");
         if constexpr (type::DomainTypeInfo<Arg>::hasMonadicBase) {
             if (arg.hasValue()) {
@@ -332,7 +486,7 @@ private:
     }
 
     template<typename Arg>
-    decltype(auto) internal_apply_non_monad(Arg&& arg) const {
+    constexpr decltype(auto) internal_apply_non_monad(Arg&& arg) const {
         static_assert(!std::is_invocable_v<std::decay_t<T>>, "Function that takes 0 arguments cannot be called with arguments");
         if constexpr (std::is_invocable_v<std::decay_t<T>, std::decay_t<Arg>>) {
             using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<T>, std::decay_t<Arg>>>;
@@ -351,27 +505,28 @@ private:
 
             if (hasValue()) {
                 return Maybe<PartialFunctionType>::Just(
-                        [callable = value(), first = std::forward<Arg>(arg)](auto&& ...args) mutable {
-                            return callable(std::move(first), std::forward<decltype(args)>(args)...);
-                        });
+                        function::BoundCall<std::decay_t<T>, typename function::Info<T>::DeclaredArgTypes, std::decay_t<Arg>>(
+                                value(), std::forward<Arg>(arg)));
             } else {
                 return Maybe<PartialFunctionType>::Nothing();
             }
         }
     }
 
-    decltype(auto) internal_apply() const {
-        static_assert(std::is_invocable_v<std::decay_t<T>>, "Function that takes one or more arguments cannot be called without arguments");
-        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<T>>>;
+    // member template, so that explicit instantiations of Maybe<T> with a non callable T skip it
+    template <typename Callable = T>
+    constexpr decltype(auto) internal_apply() const {
+        static_assert(std::is_invocable_v<std::decay_t<Callable>>, "Function that takes one or more arguments cannot be called without arguments");
+        using ReturnType = std::remove_reference_t<std::invoke_result_t<std::decay_t<Callable>>>;
 
         if (!hasValue()) {
             return Maybe<ReturnType>::Nothing();
         } else {
             if constexpr (std::is_void_v<ReturnType>) {
-                std::invoke<T>(value());
+                std::invoke<Callable>(value());
                 return Maybe<ReturnType>::Just();
             } else {
-                return Maybe<ReturnType>::Just(std::invoke<T>(value()));
+                return Maybe<ReturnType>::Just(std::invoke<Callable>(value()));
             }
         }
     }
@@ -390,7 +545,7 @@ namespace maybe {
  * @return maybe with nothing
  */
 template<typename ValueType>
-Maybe<std::remove_reference_t<ValueType>> Nothing() {
+constexpr Maybe<std::remove_reference_t<ValueType>> Nothing() {
     return Maybe<std::remove_reference_t<ValueType>>::Nothing();
 }
 
@@ -402,7 +557,7 @@ Maybe<std::remove_reference_t<ValueType>> Nothing() {
  * @return maybe with void value
  */
 template<typename T = void>
-Maybe<void> Just() { return Maybe<void>::Just(); }
+constexpr Maybe<void> Just() { return Maybe<void>::Just(); }
 
 /**
  * @ingroup Maybe
@@ -413,8 +568,21 @@ Maybe<void> Just() { return Maybe<void>::Just(); }
  * @return maybe with the value wrapped
  */
 template<typename ValueType>
-Maybe<std::remove_reference_t<ValueType>> Just(ValueType&& args) {
-    return Maybe<std::remove_reference_t<ValueType>>::Just(std::forward<ValueType>(args));
+constexpr Maybe<std::decay_t<ValueType>> Just(ValueType&& args) {
+    return Maybe<std::decay_t<ValueType>>::Just(std::forward<ValueType>(args));
+}
+
+/**
+ * @ingroup Maybe
+ *
+ * Function that helps build a Maybe with a value constructed in place.
+ * @tparam ValueType Maybe inner type
+ * @param args Arguments forwarded to the constructor of ValueType
+ * @return maybe with the value constructed in place
+ */
+template<typename ValueType, typename ...Args>
+constexpr Maybe<ValueType> Just(std::in_place_t, Args&& ...args) {
+    return Maybe<ValueType>::Just(std::in_place, std::forward<Args>(args)...);
 }
 
 /**
@@ -441,25 +609,82 @@ decltype(auto) lift(Callable &&callable) {
         }
     } else {
         using ReturnType = typename function::Info<Callable>::ReturnType;
-        using ReturnFunctionType = typename function::Info<Callable>::template LiftedSignature<Maybe>;
-
-        const ReturnFunctionType function = [callable = std::forward<Callable>(callable)](auto&& ...args) -> Maybe<ReturnType> {
-            if (all([](auto &&v) { return v.hasValue(); }, args...)) {
-                const auto tp = tuple::map_append([](auto&& arg) { return arg.value(); }, std::make_tuple(), args...);
+        using LiftedArgsTuple = typename function::Info<Callable>::template LiftedArgTypes<Maybe>;
+        using DeclaredArgsTuple = typename function::Info<Callable>::DeclaredArgTypes;
 
+        return function::make_closure<Maybe<ReturnType>, LiftedArgsTuple>([callable = std::forward<Callable>(callable)](auto&& ...args) -> Maybe<ReturnType> {
+            // short-circuits on the first Nothing, values are then passed by reference
+            if ((args.hasValue() && ...)) {
                 if constexpr (std::is_void_v<ReturnType>) {
-                    std::apply(callable, tp);
+                    function::invoke_unwrapped<DeclaredArgsTuple>(callable, std::forward<decltype(args)>(args)...);
                     return Maybe<ReturnType>::Just();
                 } else {
-                    return Maybe<ReturnType>::Just(std::apply(callable, tp));
+                    return Maybe<ReturnType>::Just(function::invoke_unwrapped<DeclaredArgsTuple>(callable, std::forward<decltype(args)>(args)...));
                 }
             } else {
                 return Maybe<ReturnType>::Nothing();
             }
-        };
+        });
+    }
+}
 
-        return function;
+/**
+ * @ingroup Maybe
+ *
+ * Applies given callable to every element of the range and collects the contained values.
+ * Stops at the first Nothing. The output is reserved once when the range size is known
+ * and elements are moved to the callable when the range is an rvalue.
+ * @tparam Range range type
+ * @tparam Callable Callable type, receives an element and returns a Maybe
+ * @param range range to traverse
+ * @param callable callable to apply to every element
+ * @return Maybe with a vector holding all the values, or Nothing if callable returned Nothing for any element
+ */
+template<typename Range, typename Callable>
+auto traverse(Range&& range, Callable&& callable) {
+    using ResultType = std::decay_t<std::invoke_result_t<Callable&, range::ForwardedElement<Range&&>>>;
+    static_assert(type::DomainTypeInfo<ResultType>::hasMonadicBase, "Callable must return a Maybe");
+    using ValueType = typename type::DomainTypeInfo<ResultType>::ValueType;
+    static_assert(!std::is_void_v<ValueType>, "Cannot collect Maybe<void> values");
+
+    std::vector<ValueType> values;
+    range::reserve(values, range);
+    for (auto&& element : range) {
+        auto result = function::invoke(callable, range::forward_element<Range&&>(element));
+        if (!result.hasValue()) {
+            return Maybe<std::vector<ValueType>>::Nothing();
+        }
+        values.push_back(*std::move(result));
+    }
+    return Maybe<std::vector<ValueType>>::Just(std::move(values));
+}
+
+/**
+ * @ingroup Maybe
+ *
+ * Turns a range of Maybe into a Maybe of a vector with the contained values.
+ * Stops at the first Nothing. The output is reserved once when the range size is known
+ * and values are moved out when the range is an rvalue.
+ * @tparam Range range type, its elements must be Maybe
+ * @param range range of Maybe
+ * @return Maybe with a vector holding all the values, or Nothing if any element is Nothing
+ */
+template<typename Range>
+auto sequence(Range&& range) {
+    using ElementType = std::decay_t<range::ForwardedElement<Range&&>>;
+    static_assert(type::DomainTypeInfo<ElementType>::hasMonadicBase, "Range elements must be Maybe");
+    using ValueType = typename type::DomainTypeInfo<ElementType>::ValueType;
+    static_assert(!std::is_void_v<ValueType>, "Cannot collect Maybe<void> values");
+
+    std::vector<ValueType> values;
+    range::reserve(values, range);
+    for (auto&& element : range) {
+        if (!element.hasValue()) {
+            return Maybe<std::vector<ValueType>>::Nothing();
+        }
+        values.push_back(*range::forward_element<Range&&>(element));
     }
+    return Maybe<std::vector<ValueType>>::Just(std::move(values));
 }
 
 } // namespace maybe
@@ -0,0 +1,343 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    MaybeVector Columnar Maybe
+ */
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "yafl/Assert.h"
+#include "yafl/Bitmap.h"
+#include "yafl/Functor.h"
+#include "yafl/Maybe.h"
+#include "yafl/Monad.h"
+#include "yafl/TypeTraits.h"
+
+namespace yafl {
+
+/**
+ * @ingroup MaybeVector
+ *
+ * Column of nullable values, i.e, the struct-of-arrays layout of a std::vector<Maybe<T>>.
+ * Values are stored densely in a single array and a packed bitmap tells which of them are valid,
+ * so there is no per element flag or padding and the values of a column can be processed in bulk.
+ * Slots of missing values hold a value initialized T, which is never passed to user callables.
+ *
+ * fmap and bind run the callable over every valid value of the whole column and return a new column.
+ */
+template <typename T>
+class MaybeVector;
+
+namespace type {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * MaybeVector traits specialization that enable getting the inner type
+ * @tparam Inner Inner type
+ */
+template<typename Inner>
+struct DomainDetailsImpl<MaybeVector<Inner>> {
+    /// Functor Base type
+    using FBaseType = core::Functor<MaybeVector, Inner>;
+    /// Monad Base type
+    using MBaseType = core::Monad<MaybeVector, Inner>;
+    /// Value Type
+    using ValueType = Inner;
+    /// Derived type
+    using DerivedType = MaybeVector<Inner>;
+    ///boolean flag that states whether type T is a Functor or not
+    static constexpr bool hasFunctorBase = std::is_base_of_v<FBaseType, DerivedType>;
+    ///boolean flag that states whether type T is an Applicative or not
+    static constexpr bool hasApplicativeBase = false;
+    ///boolean flag that states whether type T is a Monad or not
+    static constexpr bool hasMonadicBase = std::is_base_of_v<MBaseType, DerivedType>;
+    /// Same container holding another value type
+    template<typename T>
+    using RebindType = MaybeVector<T>;
+};
+} // namespace details
+} // namespace type
+
+template <typename T>
+class MaybeVector : public core::Functor<MaybeVector, T>,
+                    public core::Monad<MaybeVector, T> {
+    friend class core::Functor<MaybeVector, T>;
+    friend class core::Monad<MaybeVector, T>;
+
+    static_assert(!std::is_reference_v<T> && !std::is_void_v<T>, "MaybeVector class cannot store references or void");
+    static_assert(std::is_default_constructible_v<T>, "MaybeVector class requires a default constructible type");
+
+public:
+    /// Type of the values in the column
+    using value_type = T;
+    /// Type used for sizes and indexes
+    using size_type = std::size_t;
+
+    /**
+     * Constructs an empty column
+     */
+    MaybeVector() = default;
+
+    /**
+     * Constructs a column with size missing values
+     * @param size number of elements
+     */
+    explicit MaybeVector(std::size_t size) : _values(size), _validity(bitmap::words(size)), _size{size} {}
+
+    /**
+     * Constructs a column where all the given values are valid
+     * @param values values of the column
+     */
+    explicit MaybeVector(std::vector<T> values)
+            : _values(std::move(values)), _validity(bitmap::words(_values.size()), bitmap::FullWord), _size{_values.size()} {
+        clearTrailingBits();
+    }
+
+    /**
+     * Constructs a column from its dense values and its validity bitmap
+     * @param values values of the column, including the slots of missing values
+     * @param validity validity bitmap, with bitmap::words(values.size()) words
+     */
+    MaybeVector(std::vector<T> values, std::vector<bitmap::Word> validity)
+            : _values(std::move(values)), _validity(std::move(validity)), _size{_values.size()} {
+        YAFL_ASSERT(_validity.size() == bitmap::words(_size), "validity bitmap does not match the number of values");
+        clearTrailingBits();
+    }
+
+    /**
+     * Constructs a column from a list of Maybe
+     * @param list elements of the column
+     */
+    MaybeVector(std::initializer_list<Maybe<T>> list) {
+        reserve(list.size());
+        for (const auto& element : list) {
+            push_back(element);
+        }
+    }
+
+    /**
+     * Comparison operator overload. Only valid values are compared
+     * @param other column to compare to
+     * @return true if both columns have the same elements and false otherwise
+     */
+    bool operator==(const MaybeVector<T>& other) const {
+        if (_size != other._size || _validity != other._validity) {
+            return false;
+        }
+        bool equal = true;
+        bitmap::forEachSet(_validity.data(), _size, [&](std::size_t index) {
+            equal = equal && (_values[index] == other._values[index]);
+        });
+        return equal;
+    }
+
+    /**
+     * Number of elements, valid or not
+     * @return column size
+     */
+    [[nodiscard]] std::size_t size() const { return _size; }
+
+    /**
+     * Checks whether the column has no elements
+     * @return true if empty and false otherwise
+     */
+    [[nodiscard]] bool empty() const { return _size == 0; }
+
+    /**
+     * Number of valid elements
+     * @return number of elements that have a value
+     */
+    [[nodiscard]] std::size_t count() const { return bitmap::count(_validity.data(), _size); }
+
+    /**
+     * Reserves storage for the given number of elements
+     * @param capacity number of elements
+     */
+    void reserve(std::size_t capacity) {
+        _values.reserve(capacity);
+        _validity.reserve(bitmap::words(capacity));
+    }
+
+    /**
+     * Appends a valid value to the column
+     * @param value value to append
+     */
+    void push_back(T value) {
+        append(true);
+        _values.push_back(std::move(value));
+    }
+
+    /**
+     * Appends an element to the column
+     * @param element value to append if it exists, missing value otherwise
+     */
+    void push_back(const Maybe<T>& element) {
+        append(element.hasValue());
+        _values.push_back(element.hasValue() ? *element : T{});
+    }
+
+    /**
+     * Checks whether the element at given index has a value
+     * @param index element index
+     * @return true if valid and false otherwise
+     */
+    [[nodiscard]] bool hasValue(std::size_t index) const {
+        YAFL_ASSERT(index < _size, "index out of range");
+        return bitmap::test(_validity.data(), index);
+    }
+
+    /**
+     * Element at the given index
+     * @param index element index
+     * @return Maybe with a copy of the value, or Nothing if the element has no value
+     */
+    [[nodiscard]] Maybe<T> operator[](std::size_t index) const {
+        return hasValue(index) ? Maybe<T>::Just(_values[index]) : Maybe<T>::Nothing();
+    }
+
+    /**
+     * Dense array with the values of the column. Slots of missing values hold a value initialized T
+     * @return pointer to the first value
+     */
+    [[nodiscard]] const T* values() const { return _values.data(); }
+
+    /**
+     * Packed validity bitmap of the column, one bit per element
+     * @return pointer to the first bitmap word
+     */
+    [[nodiscard]] const bitmap::Word* validity() const { return _validity.data(); }
+
+private:
+    void append(bool valid) {
+        if (_size % bitmap::WordBits == 0) {
+            _validity.push_back(0);
+        }
+        bitmap::assign(_validity.data(), _size, valid);
+        ++_size;
+    }
+
+    void clearTrailingBits() {
+        if (_size % bitmap::WordBits != 0) {
+            _validity.back() &= (bitmap::Word{1} << (_size % bitmap::WordBits)) - 1;
+        }
+    }
+
+    template <typename Self, typename Callable>
+    static decltype(auto) fmapColumn(Self&& self, Callable&& callable) {
+        using Value = std::conditional_t<std::is_lvalue_reference_v<Self>, const T&, T&&>;
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, Value>, "Input argument is not invocable");
+        using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, Value>>;
+        static_assert(!std::is_void_v<ReturnType>, "Callable cannot return void");
+
+        std::vector<ReturnType> values(self._size);
+        auto& source = self._values;
+        bitmap::forEachSet(self._validity.data(), self._size, [&](std::size_t index) {
+            values[index] = function::invoke(callable, static_cast<Value>(source[index]));
+        });
+        return MaybeVector<ReturnType>(std::move(values), std::forward<Self>(self)._validity);
+    }
+
+    template <typename Self, typename Callable>
+    static decltype(auto) bindColumn(Self&& self, Callable&& callable) {
+        using Value = std::conditional_t<std::is_lvalue_reference_v<Self>, const T&, T&&>;
+        static_assert(std::is_invocable_v<std::decay_t<Callable>, Value>, "Input argument is not invocable");
+        using ReturnType = std::decay_t<std::invoke_result_t<std::decay_t<Callable>, Value>>;
+        using ReturnValueType = typename type::DomainTypeInfo<ReturnType>::ValueType;
+        static_assert(std::is_same_v<ReturnType, Maybe<ReturnValueType>>, "Callable must return a Maybe");
+
+        std::vector<ReturnValueType> values(self._size);
+        std::vector<bitmap::Word> validity(self._validity);
+        auto& source = self._values;
+        bitmap::forEachSet(self._validity.data(), self._size, [&](std::size_t index) {
+            auto result = function::invoke(callable, static_cast<Value>(source[index]));
+            if (result.hasValue()) {
+                values[index] = *std::move(result);
+            } else {
+                bitmap::assign(validity.data(), index, false);
+            }
+        });
+        return MaybeVector<ReturnValueType>(std::move(values), std::move(validity));
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_fmap(Callable&& callable) const& {
+        return fmapColumn(*this, std::forward<Callable>(callable));
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_fmap(Callable&& callable) && {
+        return fmapColumn(std::move(*this), std::forward<Callable>(callable));
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_bind(Callable&& callable) const& {
+        return bindColumn(*this, std::forward<Callable>(callable));
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_bind(Callable&& callable) && {
+        return bindColumn(std::move(*this), std::forward<Callable>(callable));
+    }
+
+    std::vector<T> _values;
+    std::vector<bitmap::Word> _validity;
+    std::size_t _size = 0;
+};
+
+namespace maybe_vector {
+
+namespace details {
+template <typename Callable, typename ...Args>
+auto liftColumns(const Callable& callable, const MaybeVector<Args>& ...columns) {
+    using ReturnType = std::decay_t<std::invoke_result_t<const Callable&, const Args&...>>;
+    const std::size_t size = std::get<0>(std::forward_as_tuple(columns...)).size();
+    YAFL_ASSERT(((columns.size() == size) && ...), "lifted columns must have the same size");
+
+    std::vector<bitmap::Word> validity(bitmap::words(size), bitmap::FullWord);
+    for (std::size_t w = 0; w < validity.size(); ++w) {
+        validity[w] = (validity[w] & ... & columns.validity()[w]);
+    }
+
+    std::vector<ReturnType> values(size);
+    bitmap::forEachSet(validity.data(), size, [&](std::size_t index) {
+        values[index] = function::invoke(callable, columns.values()[index]...);
+    });
+    return MaybeVector<ReturnType>(std::move(values), std::move(validity));
+}
+} // namespace details
+
+/**
+ * @ingroup MaybeVector
+ *
+ * Lifts given callable to work over whole MaybeVector columns. The lifted callable receives
+ * one column per argument, all with the same size, and returns a column where element i holds
+ * the result of callable over the elements i of the given columns, or a missing value when any
+ * of them is missing. Validity is computed word by word from the column bitmaps.
+ * @tparam Callable Callable type to lift
+ * @param callable Callable to lift
+ * @return callable lifted to work over MaybeVector columns
+ */
+template<typename Callable>
+decltype(auto) lift(Callable&& callable) {
+    using ReturnType = std::decay_t<typename function::Info<Callable>::ReturnType>;
+    using ArgsTuple = typename function::Info<Callable>::ArgTypes;
+    static_assert(std::tuple_size_v<ArgsTuple> > 0, "Callable needs at least one argument");
+    static_assert(!std::is_void_v<ReturnType>, "Callable cannot return void");
+    using LiftedArgsTuple = typename function::Info<Callable>::template LiftedArgTypes<MaybeVector>;
+
+    return function::make_closure<MaybeVector<ReturnType>, LiftedArgsTuple>([callable = std::forward<Callable>(callable)](const auto& ...columns) {
+        return details::liftColumns(callable, columns...);
+    });
+}
+
+} // namespace maybe_vector
+} // namespace yafl
@@ -0,0 +1,512 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Kernels Vectorized MaybeVector kernels
+ *
+ * Element-wise arithmetic over floating point MaybeVector columns. Every kernel computes the values
+ * of all the elements, valid or not, in a single branch free pass and the result validity as the
+ * bitwise and of the input bitmaps, one word at a time. Missing slots hold value initialized numbers,
+ * so computing them is harmless for floating point types (at most an infinity or NaN that stays hidden).
+ *
+ * The value pass runs with AVX2 (and FMA), SSE4.2 or plain scalar code, selected once at runtime
+ * through CPUID. The SIMD paths are only available on x86-64 with GCC or Clang, which allow enabling
+ * the instruction sets per function; other targets always use the scalar code, which compilers are
+ * free to auto-vectorize. The SIMD paths only exist for float and double, other floating point types
+ * (long double) always use the scalar code.
+ */
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include "yafl/Assert.h"
+#include "yafl/Bitmap.h"
+#include "yafl/MaybeVector.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define YAFL_KERNELS_X86 1
+#include <immintrin.h>
+#define YAFL_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define YAFL_TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define YAFL_KERNELS_X86 0
+#endif
+
+namespace yafl {
+namespace maybe_vector {
+
+/**
+ * @ingroup Kernels
+ *
+ * Instruction sets the kernels can run with
+ */
+enum class Isa { Scalar, Sse42, Avx2 };
+
+/**
+ * @ingroup Kernels
+ *
+ * Comparisons supported by the compare kernel. As for the scalar operators, comparisons
+ * involving NaN are false, except NotEqual which is true
+ */
+enum class Comparison { Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual };
+
+namespace details {
+
+/// Whether the SIMD paths support element type T, other floating point types use the scalar code
+template <typename T>
+constexpr bool hasSimdKernels = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+inline Isa detectIsa() {
+#if YAFL_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return Isa::Avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return Isa::Sse42;
+    }
+#endif
+    return Isa::Scalar;
+}
+
+inline Isa& selectedIsa() {
+    static Isa isa = detectIsa();
+    return isa;
+}
+
+struct Add {
+    template <typename T> static T scalar(T a, T b) { return a + b; }
+#if YAFL_KERNELS_X86
+    YAFL_TARGET_AVX2 static __m256 avx2(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+    YAFL_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+    YAFL_TARGET_SSE42 static __m128 sse(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+    YAFL_TARGET_SSE42 static __m128d sse(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+#endif
+};
+
+struct Sub {
+    template <typename T> static T scalar(T a, T b) { return a - b; }
+#if YAFL_KERNELS_X86
+    YAFL_TARGET_AVX2 static __m256 avx2(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+    YAFL_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+    YAFL_TARGET_SSE42 static __m128 sse(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+    YAFL_TARGET_SSE42 static __m128d sse(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+#endif
+};
+
+struct Mul {
+    template <typename T> static T scalar(T a, T b) { return a * b; }
+#if YAFL_KERNELS_X86
+    YAFL_TARGET_AVX2 static __m256 avx2(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+    YAFL_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+    YAFL_TARGET_SSE42 static __m128 sse(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+    YAFL_TARGET_SSE42 static __m128d sse(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+#endif
+};
+
+struct Div {
+    template <typename T> static T scalar(T a, T b) { return a / b; }
+#if YAFL_KERNELS_X86
+    YAFL_TARGET_AVX2 static __m256 avx2(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+    YAFL_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b) { return _mm256_div_pd(a, b); }
+    YAFL_TARGET_SSE42 static __m128 sse(__m128 a, __m128 b) { return _mm_div_ps(a, b); }
+    YAFL_TARGET_SSE42 static __m128d sse(__m128d a, __m128d b) { return _mm_div_pd(a, b); }
+#endif
+};
+
+// min/max instructions return their second operand when the comparison is false (e.g, NaN),
+// so operands are swapped to match std::min/std::max, which return the first one
+struct Min {
+    template <typename T> static T scalar(T a, T b) { return (b < a) ? b : a; }
+#if YAFL_KERNELS_X86
+    YAFL_TARGET_AVX2 static __m256 avx2(__m256 a, __m256 b) { return _mm256_min_ps(b, a); }
+    YAFL_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b) { return _mm256_min_pd(b, a); }
+    YAFL_TARGET_SSE42 static __m128 sse(__m128 a, __m128 b) { return _mm_min_ps(b, a); }
+    YAFL_TARGET_SSE42 static __m128d sse(__m128d a, __m128d b) { return _mm_min_pd(b, a); }
+#endif
+};
+
+struct Max {
+    template <typename T> static T scalar(T a, T b) { return (a < b) ? b : a; }
+#if YAFL_KERNELS_X86
+    YAFL_TARGET_AVX2 static __m256 avx2(__m256 a, __m256 b) { return _mm256_max_ps(b, a); }
+    YAFL_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b) { return _mm256_max_pd(b, a); }
+    YAFL_TARGET_SSE42 static __m128 sse(__m128 a, __m128 b) { return _mm_max_ps(b, a); }
+    YAFL_TARGET_SSE42 static __m128d sse(__m128d a, __m128d b) { return _mm_max_pd(b, a); }
+#endif
+};
+
+template <typename Op, typename T>
+void binaryScalar(const T* a, const T* b, T* out, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        out[i] = Op::scalar(a[i], b[i]);
+    }
+}
+
+template <typename T>
+void fmaScalar(const T* a, const T* b, const T* c, T* out, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        out[i] = std::fma(a[i], b[i], c[i]);
+    }
+}
+
+template <typename T>
+bool compareScalar(T a, T b, Comparison comparison) {
+    switch (comparison) {
+        case Comparison::Equal: return a == b;
+        case Comparison::NotEqual: return a != b;
+        case Comparison::Less: return a < b;
+        case Comparison::LessEqual: return a <= b;
+        case Comparison::Greater: return a > b;
+        case Comparison::GreaterEqual: return a >= b;
+    }
+    return false;
+}
+
+template <typename T>
+void compareScalarLoop(const T* a, const T* b, std::uint8_t* out, std::size_t begin, std::size_t size, Comparison comparison) {
+    for (std::size_t i = begin; i < size; ++i) {
+        out[i] = compareScalar(a[i], b[i], comparison) ? 1 : 0;
+    }
+}
+
+#if YAFL_KERNELS_X86
+template <typename Op>
+YAFL_TARGET_AVX2 void binaryAvx2(const float* a, const float* b, float* out, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        _mm256_storeu_ps(out + i, Op::avx2(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    binaryScalar<Op>(a + i, b + i, out + i, size - i);
+}
+
+template <typename Op>
+YAFL_TARGET_AVX2 void binaryAvx2(const double* a, const double* b, double* out, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        _mm256_storeu_pd(out + i, Op::avx2(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    binaryScalar<Op>(a + i, b + i, out + i, size - i);
+}
+
+template <typename Op>
+YAFL_TARGET_SSE42 void binarySse(const float* a, const float* b, float* out, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        _mm_storeu_ps(out + i, Op::sse(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    binaryScalar<Op>(a + i, b + i, out + i, size - i);
+}
+
+template <typename Op>
+YAFL_TARGET_SSE42 void binarySse(const double* a, const double* b, double* out, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 2 <= size; i += 2) {
+        _mm_storeu_pd(out + i, Op::sse(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    }
+    binaryScalar<Op>(a + i, b + i, out + i, size - i);
+}
+
+YAFL_TARGET_AVX2 inline void fmaAvx2(const float* a, const float* b, const float* c, float* out, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _mm256_loadu_ps(c + i)));
+    }
+    fmaScalar(a + i, b + i, c + i, out + i, size - i);
+}
+
+YAFL_TARGET_AVX2 inline void fmaAvx2(const double* a, const double* b, const double* c, double* out, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), _mm256_loadu_pd(c + i)));
+    }
+    fmaScalar(a + i, b + i, c + i, out + i, size - i);
+}
+
+// spreads the low 8 (or 4) bits of a movemask result into one 0/1 byte per bit. The multiplication
+// moves bit k to bit 8k; the top bit is placed apart since bits 0 and 7 would collide and carry
+inline void storeMask8(std::uint8_t* out, unsigned mask) {
+    const std::uint64_t bytes = ((static_cast<std::uint64_t>(mask & 0x7FU) * 0x0002040810204081ULL) & 0x0101010101010101ULL)
+                                | (static_cast<std::uint64_t>((mask >> 7U) & 1U) << 56U);
+    std::memcpy(out, &bytes, sizeof(bytes));
+}
+
+inline void storeMask4(std::uint8_t* out, unsigned mask) {
+    const std::uint32_t bytes = (static_cast<std::uint32_t>(mask) * 0x00204081U) & 0x01010101U;
+    std::memcpy(out, &bytes, sizeof(bytes));
+}
+
+YAFL_TARGET_AVX2 inline __m256 compareAvx2(__m256 a, __m256 b, Comparison comparison) {
+    switch (comparison) {
+        case Comparison::Equal: return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+        case Comparison::NotEqual: return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+        case Comparison::Less: return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+        case Comparison::LessEqual: return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+        case Comparison::Greater: return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+        case Comparison::GreaterEqual: return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+    }
+    return _mm256_setzero_ps();
+}
+
+YAFL_TARGET_AVX2 inline __m256d compareAvx2(__m256d a, __m256d b, Comparison comparison) {
+    switch (comparison) {
+        case Comparison::Equal: return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+        case Comparison::NotEqual: return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ);
+        case Comparison::Less: return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+        case Comparison::LessEqual: return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+        case Comparison::Greater: return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+        case Comparison::GreaterEqual: return _mm256_cmp_pd(a, b, _CMP_GE_OQ);
+    }
+    return _mm256_setzero_pd();
+}
+
+YAFL_TARGET_AVX2 inline void compareAvx2(const float* a, const float* b, std::uint8_t* out, std::size_t size, Comparison comparison) {
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 mask = compareAvx2(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), comparison);
+        storeMask8(out + i, static_cast<unsigned>(_mm256_movemask_ps(mask)));
+    }
+    compareScalarLoop(a, b, out, i, size, comparison);
+}
+
+YAFL_TARGET_AVX2 inline void compareAvx2(const double* a, const double* b, std::uint8_t* out, std::size_t size, Comparison comparison) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m256d mask = compareAvx2(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), comparison);
+        storeMask4(out + i, static_cast<unsigned>(_mm256_movemask_pd(mask)));
+    }
+    compareScalarLoop(a, b, out, i, size, comparison);
+}
+
+YAFL_TARGET_SSE42 inline __m128 compareSse(__m128 a, __m128 b, Comparison comparison) {
+    switch (comparison) {
+        case Comparison::Equal: return _mm_cmpeq_ps(a, b);
+        case Comparison::NotEqual: return _mm_cmpneq_ps(a, b);
+        case Comparison::Less: return _mm_cmplt_ps(a, b);
+        case Comparison::LessEqual: return _mm_cmple_ps(a, b);
+        case Comparison::Greater: return _mm_cmpgt_ps(a, b);
+        case Comparison::GreaterEqual: return _mm_cmpge_ps(a, b);
+    }
+    return _mm_setzero_ps();
+}
+
+YAFL_TARGET_SSE42 inline __m128d compareSse(__m128d a, __m128d b, Comparison comparison) {
+    switch (comparison) {
+        case Comparison::Equal: return _mm_cmpeq_pd(a, b);
+        case Comparison::NotEqual: return _mm_cmpneq_pd(a, b);
+        case Comparison::Less: return _mm_cmplt_pd(a, b);
+        case Comparison::LessEqual: return _mm_cmple_pd(a, b);
+        case Comparison::Greater: return _mm_cmpgt_pd(a, b);
+        case Comparison::GreaterEqual: return _mm_cmpge_pd(a, b);
+    }
+    return _mm_setzero_pd();
+}
+
+YAFL_TARGET_SSE42 inline void compareSse(const float* a, const float* b, std::uint8_t* out, std::size_t size, Comparison comparison) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const __m128 mask = compareSse(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i), comparison);
+        storeMask4(out + i, static_cast<unsigned>(_mm_movemask_ps(mask)));
+    }
+    compareScalarLoop(a, b, out, i, size, comparison);
+}
+
+YAFL_TARGET_SSE42 inline void compareSse(const double* a, const double* b, std::uint8_t* out, std::size_t size, Comparison comparison) {
+    std::size_t i = 0;
+    for (; i + 2 <= size; i += 2) {
+        const __m128d mask = compareSse(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i), comparison);
+        const auto bits = static_cast<unsigned>(_mm_movemask_pd(mask));
+        out[i] = static_cast<std::uint8_t>(bits & 1U);
+        out[i + 1] = static_cast<std::uint8_t>((bits >> 1U) & 1U);
+    }
+    compareScalarLoop(a, b, out, i, size, comparison);
+}
+#endif
+
+template <typename ...Columns>
+std::vector<bitmap::Word> intersectValidity(std::size_t size, const Columns& ...columns) {
+    YAFL_ASSERT(((columns.size() == size) && ...), "columns must have the same size");
+    std::vector<bitmap::Word> validity(bitmap::words(size));
+    for (std::size_t w = 0; w < validity.size(); ++w) {
+        validity[w] = (columns.validity()[w] & ...);
+    }
+    return validity;
+}
+
+template <typename Op, typename T>
+MaybeVector<T> binary(const MaybeVector<T>& a, const MaybeVector<T>& b) {
+    static_assert(std::is_floating_point_v<T>, "Kernels only support floating point columns");
+    const std::size_t size = a.size();
+    auto validity = intersectValidity(size, a, b);
+    std::vector<T> values(size);
+    if constexpr (hasSimdKernels<T>) {
+        switch (selectedIsa()) {
+#if YAFL_KERNELS_X86
+            case Isa::Avx2: binaryAvx2<Op>(a.values(), b.values(), values.data(), size); break;
+            case Isa::Sse42: binarySse<Op>(a.values(), b.values(), values.data(), size); break;
+#endif
+            default: binaryScalar<Op>(a.values(), b.values(), values.data(), size); break;
+        }
+    } else {
+        binaryScalar<Op>(a.values(), b.values(), values.data(), size);
+    }
+    return MaybeVector<T>(std::move(values), std::move(validity));
+}
+} // namespace details
+
+/**
+ * @ingroup Kernels
+ *
+ * Instruction set currently used by the kernels
+ * @return selected instruction set
+ */
+inline Isa activeIsa() {
+    return details::selectedIsa();
+}
+
+/**
+ * @ingroup Kernels
+ *
+ * Forces the kernels to use the given instruction set, e.g, to compare implementations.
+ * Not thread safe with respect to running kernels.
+ * @param isa instruction set to use
+ * @return true if the instruction set is supported by the CPU and was selected, false otherwise
+ */
+inline bool selectIsa(Isa isa) {
+    if (static_cast<int>(isa) > static_cast<int>(details::detectIsa())) {
+        return false;
+    }
+    details::selectedIsa() = isa;
+    return true;
+}
+
+/**
+ * @ingroup Kernels
+ *
+ * Element-wise addition of two columns of the same size
+ * @param a first column
+ * @param b second column
+ * @return column with a + b, valid where both a and b are valid
+ */
+template <typename T>
+MaybeVector<T> add(const MaybeVector<T>& a, const MaybeVector<T>& b) { return details::binary<details::Add>(a, b); }
+
+/**
+ * @ingroup Kernels
+ *
+ * Element-wise subtraction of two columns of the same size
+ * @param a first column
+ * @param b second column
+ * @return column with a - b, valid where both a and b are valid
+ */
+template <typename T>
+MaybeVector<T> sub(const MaybeVector<T>& a, const MaybeVector<T>& b) { return details::binary<details::Sub>(a, b); }
+
+/**
+ * @ingroup Kernels
+ *
+ * Element-wise multiplication of two columns of the same size
+ * @param a first column
+ * @param b second column
+ * @return column with a * b, valid where both a and b are valid
+ */
+template <typename T>
+MaybeVector<T> mul(const MaybeVector<T>& a, const MaybeVector<T>& b) { return details::binary<details::Mul>(a, b); }
+
+/**
+ * @ingroup Kernels
+ *
+ * Element-wise division of two columns of the same size
+ * @param a first column
+ * @param b second column
+ * @return column with a / b, valid where both a and b are valid
+ */
+template <typename T>
+MaybeVector<T> div(const MaybeVector<T>& a, const MaybeVector<T>& b) { return details::binary<details::Div>(a, b); }
+
+/**
+ * @ingroup Kernels
+ *
+ * Element-wise minimum of two columns of the same size, same as std::min
+ * @param a first column
+ * @param b second column
+ * @return column with std::min(a, b), valid where both a and b are valid
+ */
+template <typename T>
+MaybeVector<T> min(const MaybeVector<T>& a, const MaybeVector<T>& b) { return details::binary<details::Min>(a, b); }
+
+/**
+ * @ingroup Kernels
+ *
+ * Element-wise maximum of two columns of the same size, same as std::max
+ * @param a first column
+ * @param b second column
+ * @return column with std::max(a, b), valid where both a and b are valid
+ */
+template <typename T>
+MaybeVector<T> max(const MaybeVector<T>& a, const MaybeVector<T>& b) { return details::binary<details::Max>(a, b); }
+
+/**
+ * @ingroup Kernels
+ *
+ * Element-wise fused multiply-add of three columns of the same size. The result is rounded once,
+ * as std::fma, whatever the instruction set (SSE4.2 has no fused instruction and uses std::fma)
+ * @param a first column
+ * @param b second column
+ * @param c third column
+ * @return column with a * b + c, valid where a, b and c are valid
+ */
+template <typename T>
+MaybeVector<T> fma(const MaybeVector<T>& a, const MaybeVector<T>& b, const MaybeVector<T>& c) {
+    static_assert(std::is_floating_point_v<T>, "Kernels only support floating point columns");
+    const std::size_t size = a.size();
+    auto validity = details::intersectValidity(size, a, b, c);
+    std::vector<T> values(size);
+#if YAFL_KERNELS_X86
+    if constexpr (details::hasSimdKernels<T>) {
+        if (details::selectedIsa() == Isa::Avx2) {
+            details::fmaAvx2(a.values(), b.values(), c.values(), values.data(), size);
+            return MaybeVector<T>(std::move(values), std::move(validity));
+        }
+    }
+#endif
+    details::fmaScalar(a.values(), b.values(), c.values(), values.data(), size);
+    return MaybeVector<T>(std::move(values), std::move(validity));
+}
+
+/**
+ * @ingroup Kernels
+ *
+ * Element-wise comparison of two columns of the same size
+ * @param a first column
+ * @param b second column
+ * @param comparison comparison to apply
+ * @return column with 1 where a compares to b as requested and 0 otherwise, valid where both a and b are valid
+ */
+template <typename T>
+MaybeVector<std::uint8_t> compare(const MaybeVector<T>& a, const MaybeVector<T>& b, Comparison comparison) {
+    static_assert(std::is_floating_point_v<T>, "Kernels only support floating point columns");
+    const std::size_t size = a.size();
+    auto validity = details::intersectValidity(size, a, b);
+    std::vector<std::uint8_t> values(size);
+    if constexpr (details::hasSimdKernels<T>) {
+        switch (details::selectedIsa()) {
+#if YAFL_KERNELS_X86
+            case Isa::Avx2: details::compareAvx2(a.values(), b.values(), values.data(), size, comparison); break;
+            case Isa::Sse42: details::compareSse(a.values(), b.values(), values.data(), size, comparison); break;
+#endif
+            default: details::compareScalarLoop(a.values(), b.values(), values.data(), 0, size, comparison); break;
+        }
+    } else {
+        details::compareScalarLoop(a.values(), b.values(), values.data(), 0, size, comparison);
+    }
+    return MaybeVector<std::uint8_t>(std::move(values), std::move(validity));
+}
+
+} // namespace maybe_vector
+} // namespace yafl
@@ -8,8 +8,9 @@
  */
 #pragma once
 
-#include <memory>
-#include <functional>
+#include <type_traits>
+#include <utility>
+#include "yafl/TypeTraits.h"
 
 namespace yafl {
 namespace core {
@@ -34,8 +35,20 @@ public:
      * @return a new Monad with the result from the application of the function
      */
     template <typename Callable>
-    decltype(auto) bind(Callable&& callable) const {
-        return static_cast<const TDerivedMonad<Args...>*>(this)->internal_bind(std::forward<Callable>(callable));
+    constexpr decltype(auto) bind(Callable&& callable) const& {
+        return static_cast<const TDerivedMonad<Args...>&>(*this).internal_bind(std::forward<Callable>(callable));
+    }
+
+    /**
+     * Binds given callable (function, function object, lambda) to the Monad value.
+     * Rvalue overload: the wrapped value is moved into the callable instead of being copied.
+     * @tparam Callable Callable type
+     * @param callable Callback to be executed
+     * @return a new Monad with the result from the application of the function
+     */
+    template <typename Callable>
+    constexpr decltype(auto) bind(Callable&& callable) && {
+        return static_cast<TDerivedMonad<Args...>&&>(*this).internal_bind(std::forward<Callable>(callable));
     }
 };
 
@@ -54,9 +67,9 @@ namespace monad {
  * @return Monad type containing the result of the function application
  */
 template<typename Callable, typename MonadT>
-decltype(auto) bind(Callable&& callable, const MonadT& monad) {
+constexpr decltype(auto) bind(Callable&& callable, MonadT&& monad) {
     static_assert(type::DomainTypeInfo<std::decay_t<MonadT>>::hasMonadicBase, "MonadT argument not a Monad");
-    return monad.bind(std::forward<Callable>(callable));
+    return std::forward<MonadT>(monad).bind(std::forward<Callable>(callable));
 }
 
 /**
@@ -72,7 +85,7 @@ decltype(auto) bind(Callable&& callable, const MonadT& monad) {
  * @return Function lifted to work at Monad level
  */
 template<template<typename...> typename MonadType, typename Callable>
-decltype(auto) bind(Callable&& callable) {
+constexpr decltype(auto) bind(Callable&& callable) {
     if constexpr (std::is_invocable_v<Callable>) {
         return [callable = std::forward<Callable>(callable)](const MonadType<void> &monad) {
             static_assert(type::DomainTypeInfo<MonadType<void>>::hasMonadicBase, "Argument not a Functor");
@@ -0,0 +1,302 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Parallel Parallel algorithms
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "yafl/Executor.h"
+#include "yafl/TypeTraits.h"
+
+namespace yafl {
+namespace parallel {
+
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * Outcome of a chunk of a parallel traversal: values collected until the first failure
+ * of the chunk, and that failure (result or exception) with its index in the range.
+ */
+template<typename ResultType, typename ValueType>
+struct ChunkOutcome {
+    std::vector<ValueType> values;
+    std::optional<ResultType> failure;
+    std::exception_ptr exception;
+    std::size_t failedIndex;
+};
+
+/**
+ * @ingroup Details
+ *
+ * Lowers the shared failure index to the given index, unless a lower index already failed
+ */
+inline void lowerFailedIndex(std::atomic<std::size_t>& firstFailure, std::size_t index) {
+    std::size_t current = firstFailure.load(std::memory_order_relaxed);
+    while (index < current && !firstFailure.compare_exchange_weak(current, index, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @ingroup Details
+ *
+ * Traverses elements [begin, end) of the range. Stops as soon as an element fails or an element
+ * with a lower index failed in another chunk, since that one will be reported instead.
+ */
+template<typename Range, typename Iterator, typename Callable, typename Outcome>
+void traverseChunk(Iterator first, std::size_t begin, std::size_t end, Callable& callable,
+                   std::atomic<std::size_t>& firstFailure, Outcome& outcome) {
+    std::size_t index = begin;
+    try {
+        outcome.values.reserve(end - begin);
+        for (; index < end; ++index) {
+            if (index >= firstFailure.load(std::memory_order_relaxed)) {
+                return;
+            }
+            auto result = function::invoke(callable, range::forward_element<Range>(first[static_cast<std::ptrdiff_t>(index)]));
+            if (!result) {
+                outcome.failure.emplace(std::move(result));
+                outcome.failedIndex = index;
+                lowerFailedIndex(firstFailure, index);
+                return;
+            }
+            outcome.values.push_back(*std::move(result));
+        }
+    } catch (...) {
+        // also covers storing the values, so a throwing allocation never leaves the chunk task
+        outcome.exception = std::current_exception();
+        outcome.failedIndex = index;
+        lowerFailedIndex(firstFailure, index);
+    }
+}
+
+/**
+ * @ingroup Details
+ *
+ * Waits until a given number of tasks completed
+ */
+class Latch {
+public:
+    explicit Latch(std::size_t count) : _count{count} {}
+
+    void countDown(std::size_t count = 1) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _count -= count;
+        if (_count == 0) {
+            _condition.notify_all();
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _count == 0; });
+    }
+
+private:
+    std::size_t _count;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+};
+
+/**
+ * @ingroup Details
+ *
+ * Joins the given threads when destroyed, so that they are never destroyed while joinable
+ */
+class JoinGuard {
+public:
+    explicit JoinGuard(std::vector<std::thread>& threads) : _threads{threads} {}
+
+    JoinGuard(const JoinGuard&) = delete;
+    JoinGuard& operator=(const JoinGuard&) = delete;
+
+    ~JoinGuard() {
+        for (auto& thread : _threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+private:
+    std::vector<std::thread>& _threads;
+};
+
+/**
+ * @ingroup Details
+ *
+ * Body of parallel::traverse. Fork receives the number of chunks and a function running a chunk
+ * given its index; it has to run chunk 0 in the calling thread, the others concurrently, and
+ * return once all of them completed.
+ */
+template<typename Range, typename Callable, typename Fork>
+auto traverse(Range&& range, Callable&& callable, std::size_t concurrency, std::size_t minChunkSize, Fork&& fork) {
+    using ResultType = std::decay_t<std::invoke_result_t<Callable&, range::ForwardedElement<Range&&>>>;
+    using ResultInfo = type::DomainTypeInfo<ResultType>;
+    static_assert(ResultInfo::hasMonadicBase, "Callable must return a Monad");
+    using ValueType = typename ResultInfo::ValueType;
+    static_assert(!std::is_void_v<ValueType>, "Cannot collect void values");
+    using CollectedType = typename ResultInfo::template RebindType<std::vector<ValueType>>;
+    using Outcome = ChunkOutcome<ResultType, ValueType>;
+    using Iterator = decltype(std::begin(range));
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>,
+                  "parallel::traverse requires a random access range");
+
+    const auto first = std::begin(range);
+    const auto size = static_cast<std::size_t>(std::distance(first, std::end(range)));
+    if (concurrency == 0) {
+        concurrency = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    const std::size_t chunks = std::max<std::size_t>(std::min(concurrency, size / std::max<std::size_t>(minChunkSize, 1)), 1);
+    const std::size_t chunkSize = size / chunks;
+    const std::size_t remainder = size % chunks;
+
+    std::atomic<std::size_t> firstFailure{size};
+    std::vector<Outcome> outcomes(chunks);
+    fork(chunks, [&](std::size_t chunk) {
+        const std::size_t begin = chunk * chunkSize + std::min(chunk, remainder);
+        const std::size_t end = begin + chunkSize + (chunk < remainder ? 1 : 0);
+        traverseChunk<Range&&>(first, begin, end, callable, firstFailure, outcomes[chunk]);
+    });
+
+    const std::size_t failedIndex = firstFailure.load(std::memory_order_relaxed);
+    if (failedIndex < size) {
+        for (auto& outcome : outcomes) {
+            if ((outcome.failure || outcome.exception) && outcome.failedIndex == failedIndex) {
+                if (outcome.exception) {
+                    std::rethrow_exception(outcome.exception);
+                }
+                return type::DomainTypeInfo<CollectedType>::handleError(*std::move(outcome.failure));
+            }
+        }
+    }
+
+    std::vector<ValueType> values;
+    if (chunks == 1) {
+        values = std::move(outcomes[0].values);
+    } else {
+        values.reserve(size);
+        for (auto& outcome : outcomes) {
+            std::move(outcome.values.begin(), outcome.values.end(), std::back_inserter(values));
+        }
+    }
+    return type::DomainTypeInfo<CollectedType>::wrapValue(std::move(values));
+}
+} // namespace details
+
+/**
+ * @ingroup Parallel
+ *
+ * Parallel version of traverse: applies given callable to every element of a random access range,
+ * splitting the range in contiguous chunks processed by different threads, and collects the values.
+ * As soon as an element fails, chunks stop processing elements past that index. The result is
+ * deterministic: on failure, the failure with the lowest index in the range is returned, which is
+ * the same result the sequential traverse would produce. Exceptions thrown by callable are
+ * rethrown in the calling thread following the same rule.
+ *
+ * Works with any monad whose type::details::DomainDetailsImpl specialization provides ValueType,
+ * handleError, wrapValue and RebindType (like Maybe and Either do), and that provides operator!
+ * to check for failure and operator* to access the value.
+ *
+ * Callable is invoked concurrently from several threads, so it must be safe to do so. When no
+ * more threads can be started, the calling thread runs the chunks left.
+ * @tparam Range random access range type
+ * @tparam Callable Callable type, receives an element and returns a monad
+ * @param range range to traverse
+ * @param callable callable to apply to every element
+ * @param concurrency maximum number of threads to use, including the calling thread. 0 uses the hardware concurrency
+ * @param minChunkSize minimum number of elements per thread, so that small ranges are not split
+ * @return monad with a vector holding all the values, or the failure with the lowest index
+ */
+template<typename Range, typename Callable>
+auto traverse(Range&& range, Callable&& callable, std::size_t concurrency = 0, std::size_t minChunkSize = 4096) {
+    return details::traverse(std::forward<Range>(range), std::forward<Callable>(callable), concurrency, minChunkSize,
+                             [](std::size_t chunks, const auto& runChunk) {
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+        const details::JoinGuard joinWorkers(workers);
+        std::size_t started = 1;
+        try {
+            for (; started < chunks; ++started) {
+                workers.emplace_back([&runChunk, chunk = started]() { runChunk(chunk); });
+            }
+        } catch (const std::system_error&) {
+            // no more threads available, the calling thread runs the chunks left
+        }
+        // chunk 0 runs in the calling thread
+        runChunk(0);
+        for (std::size_t chunk = started; chunk < chunks; ++chunk) {
+            runChunk(chunk);
+        }
+    });
+}
+
+/**
+ * @ingroup Parallel
+ *
+ * Same as traverse, but chunks run as tasks of the given executor instead of dedicated threads,
+ * so repeated traversals reuse the threads of a pool. Chunk 0 still runs in the calling thread,
+ * which blocks until the other chunks completed: do not call it from a task of a pool that has
+ * no other worker free to run them. Chunks the executor fails to accept run in the calling thread.
+ * @tparam Range random access range type
+ * @tparam Callable Callable type, receives an element and returns a monad
+ * @param executor executor running the chunks
+ * @param range range to traverse
+ * @param callable callable to apply to every element
+ * @param concurrency maximum number of chunks processed concurrently, including the calling thread. 0 uses the hardware concurrency
+ * @param minChunkSize minimum number of elements per chunk, so that small ranges are not split
+ * @return monad with a vector holding all the values, or the failure with the lowest index
+ */
+template<typename Range, typename Callable>
+auto traverse(executor::Executor& executor, Range&& range, Callable&& callable, std::size_t concurrency = 0, std::size_t minChunkSize = 4096) {
+    return details::traverse(std::forward<Range>(range), std::forward<Callable>(callable), concurrency, minChunkSize,
+                             [&executor](std::size_t chunks, const auto& runChunk) {
+        details::Latch done(chunks - 1);
+        std::size_t submitted = 1;
+        try {
+            for (; submitted < chunks; ++submitted) {
+                executor.execute([&runChunk, &done, chunk = submitted]() {
+                    runChunk(chunk);
+                    done.countDown();
+                });
+            }
+        } catch (...) {
+            // the executor rejected the task, the calling thread runs the chunks left
+        }
+        // only the submitted tasks are waited for
+        done.countDown(chunks - submitted);
+
+        // the submitted tasks reference done and runChunk, so they are waited for even if a chunk throws
+        std::exception_ptr exception;
+        try {
+            runChunk(0);
+            for (std::size_t chunk = submitted; chunk < chunks; ++chunk) {
+                runChunk(chunk);
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        done.wait();
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    });
+}
+
+} // namespace parallel
+} // namespace yafl
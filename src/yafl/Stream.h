@@ -0,0 +1,539 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Stream Stream
+ */
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "yafl/Applicative.h"
+#include "yafl/Functor.h"
+#include "yafl/Monad.h"
+#include "yafl/TypeTraits.h"
+
+namespace yafl {
+
+/**
+ * @ingroup Stream
+ *
+ * Lazy, pull-based sequence of values. A stream is a generator, a small value type whose next()
+ * produces one Step at a time, and every operation (fmap, bind, filter, take, zip) wraps the generator of
+ * its source into a new one. Nothing runs until a terminal operation (fold, tryFold, toVector) pulls the
+ * elements, and since the whole pipeline is encoded in the generator type, the compiler inlines it into
+ * a single loop without intermediate containers (stream fusion).
+ *
+ * Following the stream fusion technique, generators may answer Skip instead of looping themselves,
+ * e.g, filter on a rejected element, so that no step of a pipeline hides an inner loop.
+ * Streams are descriptions: terminal operations work on a copy, so a stream can be consumed many times
+ * as long as its source, e.g, the container given to stream::from, is alive.
+ * @tparam T Element type
+ * @tparam Generator Generator type
+ */
+template <typename T, typename Generator>
+class Stream;
+
+namespace type {
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * Stream traits specialization that enable getting the element type
+ * @tparam Inner Element type
+ * @tparam Generator Generator type
+ */
+template<typename Inner, typename Generator>
+struct DomainDetailsImpl<Stream<Inner, Generator>> {
+    /// Functor Base type
+    using FBaseType = core::Functor<Stream, Inner, Generator>;
+    /// Applicative Base type
+    using ABaseType = core::Applicative<Stream, Inner, Generator>;
+    /// Monad Base type
+    using MBaseType = core::Monad<Stream, Inner, Generator>;
+    /// Value Type
+    using ValueType = Inner;
+    /// Derived type
+    using DerivedType = Stream<Inner, Generator>;
+    ///boolean flag that states whether type T is a Functor or not
+    static constexpr bool hasFunctorBase = std::is_base_of_v<FBaseType, DerivedType>;
+    ///boolean flag that states whether type T is an Applicative or not
+    static constexpr bool hasApplicativeBase = std::is_base_of_v<ABaseType, DerivedType>;
+    ///boolean flag that states whether type T is a Monad or not
+    static constexpr bool hasMonadicBase = std::is_base_of_v<MBaseType, DerivedType>;
+    ///boolean flag that states that the value of T has to be chained, not inspected
+    static constexpr bool isAsync = true;
+};
+} // namespace details
+} // namespace type
+
+namespace stream {
+
+/**
+ * @ingroup Stream
+ *
+ * Result of pulling a stream once: Done when exhausted, Skip when the generator made progress
+ * without producing an element, or Yield with the next element
+ * @tparam T Element type
+ */
+template <typename T>
+class Step {
+public:
+    static Step<T> Done() { return Step<T>(true); }
+
+    static Step<T> Skip() { return Step<T>(false); }
+
+    static Step<T> Yield(T value) { return Step<T>(std::move(value)); }
+
+    [[nodiscard]] bool isDone() const { return _done; }
+
+    [[nodiscard]] bool isYield() const { return _value.has_value(); }
+
+    [[nodiscard]] T& value() & { return *_value; }
+
+    [[nodiscard]] T&& value() && { return std::move(*_value); }
+
+private:
+    explicit Step(bool done) : _done{done} {}
+
+    explicit Step(T value) : _value{std::move(value)}, _done{false} {}
+
+    std::optional<T> _value;
+    bool _done;
+};
+
+namespace details {
+
+/**
+ * @ingroup Details
+ *
+ * Checks whether T is a Stream
+ * @tparam T type to check
+ */
+template <typename T>
+struct IsStream : std::false_type {};
+
+template <typename T, typename Generator>
+struct IsStream<Stream<T, Generator>> : std::true_type {};
+
+/// Generator over an iterator range, the range must outlive the stream
+template <typename Iterator>
+class IteratorGenerator {
+public:
+    using ValueType = std::decay_t<typename std::iterator_traits<Iterator>::value_type>;
+
+    IteratorGenerator(Iterator first, Iterator last) : _current{first}, _last{last} {}
+
+    Step<ValueType> next() {
+        if (_current == _last) {
+            return Step<ValueType>::Done();
+        }
+        return Step<ValueType>::Yield(*_current++);
+    }
+
+private:
+    Iterator _current;
+    Iterator _last;
+};
+
+/// Generator of the infinite sequence seed, f(seed), f(f(seed))... Each successor is computed
+/// on the pull that yields it, so n pulls call f n - 1 times
+template <typename T, typename Callable>
+class IterateGenerator {
+public:
+    using ValueType = T;
+
+    IterateGenerator(T seed, Callable callable) : _current{std::move(seed)}, _callable{std::move(callable)} {}
+
+    Step<ValueType> next() {
+        if (_started) {
+            _current = function::invoke(_callable, std::as_const(_current));
+        }
+        _started = true;
+        return Step<ValueType>::Yield(_current);
+    }
+
+private:
+    T _current;
+    Callable _callable;
+    bool _started = false;
+};
+
+/// Generator applying a function to every element of its source
+template <typename Source, typename Callable>
+class MapGenerator {
+public:
+    using SourceType = typename Source::ValueType;
+    using ValueType = std::decay_t<std::invoke_result_t<const Callable&, SourceType>>;
+
+    MapGenerator(Source source, Callable callable) : _source{std::move(source)}, _callable{std::move(callable)} {}
+
+    Step<ValueType> next() {
+        auto step = _source.next();
+        if (!step.isYield()) {
+            return step.isDone() ? Step<ValueType>::Done() : Step<ValueType>::Skip();
+        }
+        return Step<ValueType>::Yield(function::invoke(_callable, std::move(step).value()));
+    }
+
+private:
+    Source _source;
+    Callable _callable;
+};
+
+/// Generator dropping the elements of its source that do not satisfy a predicate
+template <typename Source, typename Predicate>
+class FilterGenerator {
+public:
+    using ValueType = typename Source::ValueType;
+
+    FilterGenerator(Source source, Predicate predicate) : _source{std::move(source)}, _predicate{std::move(predicate)} {}
+
+    Step<ValueType> next() {
+        auto step = _source.next();
+        if (step.isYield() && !function::invoke(_predicate, std::as_const(step.value()))) {
+            return Step<ValueType>::Skip();
+        }
+        return step;
+    }
+
+private:
+    Source _source;
+    Predicate _predicate;
+};
+
+/// Generator stopping after a given number of elements, so infinite sources can be consumed
+template <typename Source>
+class TakeGenerator {
+public:
+    using ValueType = typename Source::ValueType;
+
+    TakeGenerator(Source source, std::size_t count) : _source{std::move(source)}, _remaining{count} {}
+
+    Step<ValueType> next() {
+        if (_remaining == 0) {
+            return Step<ValueType>::Done();
+        }
+        auto step = _source.next();
+        if (step.isYield()) {
+            --_remaining;
+        }
+        return step;
+    }
+
+private:
+    Source _source;
+    std::size_t _remaining;
+};
+
+/// Generator pairing the elements of two sources, stops when either is exhausted
+template <typename Left, typename Right>
+class ZipGenerator {
+public:
+    using LeftType = typename Left::ValueType;
+    using RightType = typename Right::ValueType;
+    using ValueType = std::pair<LeftType, RightType>;
+
+    ZipGenerator(Left left, Right right) : _left{std::move(left)}, _right{std::move(right)} {}
+
+    Step<ValueType> next() {
+        if (!_pending) {
+            auto step = _left.next();
+            if (!step.isYield()) {
+                return step.isDone() ? Step<ValueType>::Done() : Step<ValueType>::Skip();
+            }
+            _pending.emplace(std::move(step).value());
+        }
+        auto step = _right.next();
+        if (!step.isYield()) {
+            return step.isDone() ? Step<ValueType>::Done() : Step<ValueType>::Skip();
+        }
+        Step<ValueType> result = Step<ValueType>::Yield(ValueType(std::move(*_pending), std::move(step).value()));
+        _pending.reset();
+        return result;
+    }
+
+private:
+    Left _left;
+    Right _right;
+    std::optional<LeftType> _pending;
+};
+
+/// Generator concatenating the streams produced by a function for every element of its source
+template <typename Source, typename Callable>
+class BindGenerator {
+public:
+    using InnerStream = std::decay_t<std::invoke_result_t<const Callable&, typename Source::ValueType>>;
+    using ValueType = typename type::DomainTypeInfo<InnerStream>::ValueType;
+
+    BindGenerator(Source source, Callable callable) : _source{std::move(source)}, _callable{std::move(callable)} {}
+
+    Step<ValueType> next() {
+        if (_inner) {
+            auto step = _inner->next();
+            if (!step.isDone()) {
+                return step;
+            }
+            _inner.reset();
+        }
+        auto step = _source.next();
+        if (step.isYield()) {
+            _inner.emplace(function::invoke(_callable, std::move(step).value()));
+        }
+        return step.isDone() ? Step<ValueType>::Done() : Step<ValueType>::Skip();
+    }
+
+private:
+    Source _source;
+    Callable _callable;
+    std::optional<InnerStream> _inner;
+};
+
+} // namespace details
+} // namespace stream
+
+template <typename T, typename Generator>
+class Stream : public core::Functor<Stream, T, Generator>
+             , public core::Applicative<Stream, T, Generator>
+             , public core::Monad<Stream, T, Generator> {
+    friend class core::Functor<Stream, T, Generator>;
+    friend class core::Applicative<Stream, T, Generator>;
+    friend class core::Monad<Stream, T, Generator>;
+
+    template <typename, typename> friend class Stream;
+
+    static_assert(std::is_same_v<T, typename Generator::ValueType>, "Generator has to produce the Stream element type");
+
+public:
+    /// Type of the generator
+    using GeneratorType = Generator;
+
+    /**
+     * Constructs a stream from its generator
+     * @param generator generator producing the elements
+     */
+    explicit Stream(Generator generator) : _generator{std::move(generator)} {}
+
+    /**
+     * Pulls the stream once
+     * @return Done, Skip or Yield with the next element
+     */
+    stream::Step<T> next() { return _generator.next(); }
+
+    /**
+     * Keeps only the elements satisfying the predicate
+     * @tparam Predicate predicate type
+     * @param predicate predicate receiving a const reference to each element
+     * @return filtered stream
+     */
+    template <typename Predicate>
+    decltype(auto) filter(Predicate&& predicate) const {
+        static_assert(std::is_invocable_r_v<bool, std::decay_t<Predicate>&, const T&>, "Predicate has to take an element and return bool");
+        using Next = stream::details::FilterGenerator<Generator, std::decay_t<Predicate>>;
+        return Stream<T, Next>(Next(_generator, std::forward<Predicate>(predicate)));
+    }
+
+    /**
+     * Keeps at most the first count elements, the source is not pulled any further
+     * @param count maximum number of elements
+     * @return truncated stream
+     */
+    decltype(auto) take(std::size_t count) const {
+        using Next = stream::details::TakeGenerator<Generator>;
+        return Stream<T, Next>(Next(_generator, count));
+    }
+
+    /**
+     * Pairs the elements of this stream with the elements of another one
+     * @tparam U element type of the other stream
+     * @tparam OtherGenerator generator type of the other stream
+     * @param other other stream
+     * @return stream of pairs, as long as the shortest stream
+     */
+    template <typename U, typename OtherGenerator>
+    decltype(auto) zip(const Stream<U, OtherGenerator>& other) const {
+        using Next = stream::details::ZipGenerator<Generator, OtherGenerator>;
+        return Stream<std::pair<T, U>, Next>(Next(_generator, other._generator));
+    }
+
+    /**
+     * Reduces the stream with a binary function
+     * @tparam Accumulator accumulator type
+     * @tparam Callable callable type, (Accumulator, T) -> Accumulator
+     * @param initial initial value of the accumulator
+     * @param callable reducing function
+     * @return the accumulated value
+     */
+    template <typename Accumulator, typename Callable>
+    Accumulator fold(Accumulator initial, Callable&& callable) const {
+        auto generator = _generator;
+        for (;;) {
+            auto step = generator.next();
+            if (step.isDone()) {
+                return initial;
+            }
+            if (step.isYield()) {
+                initial = function::invoke(callable, std::move(initial), std::move(step).value());
+            }
+        }
+    }
+
+    /**
+     * Reduces a stream of Maybe/Either elements over their values, stopping at the first Nothing/Error:
+     * the remaining elements are not pulled, so the upstream steps do not run for them
+     * @tparam Accumulator accumulator type
+     * @tparam Callable callable type, (Accumulator, value of T) -> Accumulator
+     * @param initial initial value of the accumulator
+     * @param callable reducing function
+     * @return the accumulated value wrapped in a Maybe/Either, or the first Nothing/Error
+     */
+    template <typename Accumulator, typename Callable>
+    decltype(auto) tryFold(Accumulator initial, Callable&& callable) const {
+        static_assert(type::DomainTypeInfo<T>::hasMonadicBase && !type::IsAsync<T>::value, "Stream elements have to be Maybe or Either");
+        using ResultType = typename type::DomainTypeInfo<T>::template RebindType<Accumulator>;
+
+        auto generator = _generator;
+        for (;;) {
+            auto step = generator.next();
+            if (step.isDone()) {
+                return type::DomainTypeInfo<ResultType>::wrapValue(std::move(initial));
+            }
+            if (step.isYield()) {
+                T& element = step.value();
+                if (!element) {
+                    return ResultType(type::DomainTypeInfo<ResultType>::handleError(element));
+                }
+                initial = function::invoke(callable, std::move(initial), *std::move(element));
+            }
+        }
+    }
+
+    /**
+     * Collects the elements in a vector
+     * @return vector with every element of the stream
+     */
+    [[nodiscard]] std::vector<T> toVector() const {
+        return fold(std::vector<T>{}, [](std::vector<T> values, T value) {
+            values.push_back(std::move(value));
+            return values;
+        });
+    }
+
+private:
+    template <typename Callable>
+    decltype(auto) internal_fmap(Callable&& callable) const {
+        static_assert(std::is_invocable_v<const std::decay_t<Callable>&, T>, "Input argument is not invocable");
+        using Next = stream::details::MapGenerator<Generator, std::decay_t<Callable>>;
+        static_assert(!std::is_void_v<typename Next::ValueType>, "Callable cannot return void");
+        return Stream<typename Next::ValueType, Next>(Next(_generator, std::forward<Callable>(callable)));
+    }
+
+    template <typename Callable>
+    decltype(auto) internal_bind(Callable&& callable) const {
+        static_assert(std::is_invocable_v<const std::decay_t<Callable>&, T>, "Input argument is not invocable");
+        using Next = stream::details::BindGenerator<Generator, std::decay_t<Callable>>;
+        static_assert(stream::details::IsStream<typename Next::InnerStream>::value, "Callable has to return a Stream");
+        return Stream<typename Next::ValueType, Next>(Next(_generator, std::forward<Callable>(callable)));
+    }
+
+    template <typename Arg>
+    decltype(auto) internal_apply(Arg&& arg) const {
+        static_assert(!std::is_invocable_v<std::decay_t<T>>, "Function that takes 0 arguments cannot be called with arguments");
+        using ArgType = std::decay_t<Arg>;
+        if constexpr (stream::details::IsStream<ArgType>::value) {
+            return internal_bind([arg = std::forward<Arg>(arg)](const T& callable) {
+                return arg.fmap([callable](const auto& value) { return applyFirst(callable, value); });
+            });
+        } else {
+            return internal_fmap([arg = std::forward<Arg>(arg)](const T& callable) { return applyFirst(callable, arg); });
+        }
+    }
+
+    decltype(auto) internal_apply() const {
+        static_assert(std::is_invocable_v<std::decay_t<T>>, "Function that takes one or more arguments cannot be called without arguments");
+        return internal_fmap([](const T& callable) { return std::invoke(callable); });
+    }
+
+    template <typename Arg>
+    static decltype(auto) applyFirst(const T& callable, const Arg& arg) {
+        if constexpr (std::is_invocable_v<const T&, const Arg&>) {
+            return std::invoke(callable, arg);
+        } else {
+            using PartialFunctionType = std::remove_reference_t<typename function::Info<T>::PartialApplyFirst>;
+            return PartialFunctionType([callable, first = arg](auto&& ...args) {
+                return std::invoke(callable, first, std::forward<decltype(args)>(args)...);
+            });
+        }
+    }
+
+    Generator _generator;
+};
+
+namespace stream {
+
+/**
+ * @ingroup Stream
+ *
+ * Streams the elements of a range, which must outlive the stream
+ * @tparam Range range type
+ * @param range range to stream
+ * @return stream of copies of the range elements
+ */
+template <typename Range>
+decltype(auto) from(const Range& range) {
+    using Iterator = decltype(std::begin(range));
+    using Generator = details::IteratorGenerator<Iterator>;
+    return Stream<typename Generator::ValueType, Generator>(Generator(std::begin(range), std::end(range)));
+}
+
+/**
+ * @ingroup Stream
+ *
+ * Infinite stream seed, f(seed), f(f(seed))... to be bounded with take
+ * @tparam T element type
+ * @tparam Callable callable type, T -> T
+ * @param seed first element
+ * @param callable function producing the next element
+ * @return infinite stream
+ */
+template <typename T, typename Callable>
+decltype(auto) iterate(T seed, Callable&& callable) {
+    using Generator = details::IterateGenerator<T, std::decay_t<Callable>>;
+    return Stream<T, Generator>(Generator(std::move(seed), std::forward<Callable>(callable)));
+}
+
+/**
+ * @ingroup Stream
+ *
+ * Streams the values first, first + 1, ..., up to the last one below last
+ * @tparam T arithmetic type
+ * @param first first value
+ * @param last value past the last one
+ * @return stream of the range
+ */
+template <typename T>
+decltype(auto) range(T first, T last) {
+    static_assert(std::is_arithmetic_v<T>, "range requires an arithmetic type");
+    std::size_t count = 0;
+    if (first < last) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // every value below last is yielded, e.g, range(0.0, 2.5) yields 0, 1 and 2
+            count = static_cast<std::size_t>(std::ceil(last - first));
+        } else {
+            // unsigned difference, last - first may overflow T
+            count = static_cast<std::size_t>(last) - static_cast<std::size_t>(first);
+        }
+    }
+    return iterate(first, [](T value) { return static_cast<T>(value + 1); }).take(count);
+}
+
+} // namespace stream
+} // namespace yafl
@@ -1,9 +1,10 @@
 /**
- * \brief       Traits for Functions, Tuples and YAFL types
+ * \brief       Traits for Functions, Ranges, Tuples and YAFL types
  *
  * \copyright   2023, Ernesto Festas.
  *              Distributed under MIT license (See accompanying LICENSE file)
  * \defgroup    Function Function type traits
+ * \defgroup    Range Range traits
  * \defgroup    Tuple Tuple type traits
  * \defgroup    Type Yafl type traits
  */
@@ -12,6 +13,9 @@
 #include <type_traits>
 #include <cstddef>
 #include <functional>
+#include <iterator>
+#include <tuple>
+#include <utility>
 
 namespace yafl {
 
@@ -30,6 +34,20 @@ namespace details {
 template<typename ...>
 struct CallableDetails;
 
+/**
+ * @ingroup Details
+ *
+ * Type of an argument of a lifted function. Copyable types are taken by const reference,
+ * while move-only types are taken by rvalue reference so that their value can be moved
+ * out of the lifted argument.
+ * @tparam TLift Type to lift the argument into
+ * @tparam Arg Argument type
+ */
+template<template<typename...> typename TLift, typename Arg>
+using LiftedArg = std::conditional_t<std::is_copy_constructible_v<std::decay_t<Arg>>,
+                                     const TLift<std::decay_t<Arg>>&,
+                                     TLift<std::decay_t<Arg>>&&>;
+
 /**
  * @ingroup Details
  *
@@ -45,13 +63,20 @@ struct CallableDetails<Ret, FirstArg, Args...> {
     using Signature = std::function<Ret(FirstArg, Args...)>;
     ///Function Signature lifted to TLift
     template<template<typename...> typename TLift>
-    using LiftedSignature = std::function<TLift<Ret>(const TLift<std::decay_t<FirstArg>>&, const TLift<std::decay_t<Args>>&...)>;
+    using LiftedSignature = std::function<TLift<Ret>(LiftedArg<TLift, FirstArg>, LiftedArg<TLift, Args>...)>;
+    ///Argument types of the lifted function signature, provided in a tuple
+    template<template<typename...> typename TLift>
+    using LiftedArgTypes = std::tuple<LiftedArg<TLift, FirstArg>, LiftedArg<TLift, Args>...>;
     ///Function Signature after applying first argument
     using PartialApplyFirst = std::function<Ret(Args...)>;
+    ///Function argument types after applying first argument, provided in a tuple
+    using PartialApplyFirstArgTypes = std::tuple<Args...>;
     ///Return type
     using ReturnType = Ret;
     ///Function argument types, provided in a tuple
     using ArgTypes = std::tuple<std::decay_t<FirstArg>, std::decay_t<Args>...>;
+    ///Function argument types as declared (not decayed), provided in a tuple
+    using DeclaredArgTypes = std::tuple<FirstArg, Args...>;
     ///Number of arguments
     static constexpr std::size_t ArgCount = sizeof...(Args) + 1;
     ///Getter for argument with ID idx
@@ -74,36 +99,113 @@ struct CallableDetails<Ret> {
     using ReturnType = Ret;
     ///Function argument types, provided in a tuple
     using ArgTypes = std::tuple<>;
+    ///Function argument types as declared (not decayed), provided in a tuple
+    using DeclaredArgTypes = std::tuple<>;
     ///Number of arguments
     static constexpr std::size_t ArgCount = 0;
 };
 
-template<typename>
-struct CallableHelper;
-
-template<typename Ret, typename... Args>
-struct CallableHelper<std::function<Ret(&)(Args...)>> : details::CallableDetails<Ret, Args...> {
+/**
+ * @ingroup Details
+ *
+ * Splits a pointer to member function into its signature, for every cv/ref/noexcept qualification.
+ * CallOperatorDetails describes the member as a call operator (the object is implicit), while
+ * MemberPointerDetails describes it as invoked through std::invoke (the object is the first argument).
+ * @tparam MemberFunction pointer to member function type
+ */
+template<typename MemberFunction>
+struct MemberFunctionTraits;
+
+#define YAFL_MEMBER_FUNCTION_TRAITS(QUALIFIERS, OBJECT)                                          \
+template<typename Ret, typename ClassType, typename... Args>                                      \
+struct MemberFunctionTraits<Ret (ClassType::*)(Args...) QUALIFIERS> {                           \
+    using CallOperatorDetails = CallableDetails<Ret, Args...>;                                   \
+    using MemberPointerDetails = CallableDetails<Ret, OBJECT, Args...>;                          \
+};                                                                                               \
+template<typename Ret, typename ClassType, typename... Args>                                      \
+struct MemberFunctionTraits<Ret (ClassType::*)(Args...) QUALIFIERS noexcept> {                  \
+    using CallOperatorDetails = CallableDetails<Ret, Args...>;                                   \
+    using MemberPointerDetails = CallableDetails<Ret, OBJECT, Args...>;                          \
 };
 
-template<typename Ret, typename... Args>
-struct CallableHelper<std::function<Ret(Args...)>> : details::CallableDetails<Ret, Args...> {
-};
+YAFL_MEMBER_FUNCTION_TRAITS(, ClassType&)
+YAFL_MEMBER_FUNCTION_TRAITS(const, const ClassType&)
+YAFL_MEMBER_FUNCTION_TRAITS(&, ClassType&)
+YAFL_MEMBER_FUNCTION_TRAITS(const&, const ClassType&)
+YAFL_MEMBER_FUNCTION_TRAITS(&&, ClassType&&)
+YAFL_MEMBER_FUNCTION_TRAITS(const&&, const ClassType&&)
 
-template<typename Ret, typename ClassType, typename... Args>
-struct CallableHelper<std::function<Ret (ClassType::*)(Args...) const>> : details::CallableDetails<Ret, Args...> {
-};
+#undef YAFL_MEMBER_FUNCTION_TRAITS
 
-template<typename Ret, typename ClassType, typename... Args>
-struct CallableHelper<std::function<Ret (ClassType::*)(Args...)>> : details::CallableDetails<Ret, Args...> {
-};
+/**
+ * @ingroup Details
+ *
+ * Pointer to data member, invoked as a getter taking the object
+ * @tparam MemberObject pointer to data member type
+ */
+template<typename MemberObject>
+struct MemberObjectTraits;
 
-template<typename Ret, typename ClassType, typename... Args>
-struct CallableHelper<std::function<Ret (ClassType::* &)(Args...)>> : details::CallableDetails<Ret, Args...> {
+template<typename T, typename ClassType>
+struct MemberObjectTraits<T ClassType::*> {
+    using MemberPointerDetails = CallableDetails<const T&, const ClassType&>;
 };
 
+/**
+ * @ingroup Details
+ *
+ * Deduces the signature of a callable without any type erasure. Function pointers and pointers
+ * to members are decomposed directly, class types through their call operator. Generic lambdas
+ * and overloaded function objects have no single signature, so nothing is provided for them.
+ * @tparam Callable decayed callable type
+ */
+template<typename Callable, typename = void>
+struct SignatureHelper {};
+
 template<typename Ret, typename... Args>
-struct CallableHelper<std::function<Ret (*)(Args...)>> : details::CallableDetails<Ret, Args...> {
-};
+struct SignatureHelper<Ret (*)(Args...)> : CallableDetails<Ret, Args...> {};
+
+template<typename Ret, typename... Args>
+struct SignatureHelper<Ret (*)(Args...) noexcept> : CallableDetails<Ret, Args...> {};
+
+template<typename Callable>
+struct SignatureHelper<Callable, std::enable_if_t<std::is_member_function_pointer_v<Callable>>>
+        : MemberFunctionTraits<Callable>::MemberPointerDetails {};
+
+template<typename Callable>
+struct SignatureHelper<Callable, std::enable_if_t<std::is_member_object_pointer_v<Callable>>>
+        : MemberObjectTraits<Callable>::MemberPointerDetails {};
+
+template<typename Callable>
+struct SignatureHelper<Callable, std::void_t<decltype(&Callable::operator())>>
+        : MemberFunctionTraits<decltype(&Callable::operator())>::CallOperatorDetails {};
+
+/// Callables whose call operator is overloaded per value category declare their signature as CallSignature
+template<typename Callable>
+struct SignatureHelper<Callable, std::void_t<typename Callable::CallSignature>> : Callable::CallSignature {};
+
+template<typename Callable, typename = void>
+struct HasSignature : std::false_type {};
+
+template<typename Callable>
+struct HasSignature<Callable, std::void_t<typename SignatureHelper<Callable>::ReturnType>> : std::true_type {};
+
+/**
+ * @ingroup Details
+ *
+ * Uses the signature of the callable if it has one, otherwise the argument types known from
+ * the context, when the callable can be invoked with them
+ * @tparam Callable decayed callable type
+ * @tparam Context tuple with the argument types the callable will be invoked with
+ */
+template<typename Callable, typename Context, typename = void>
+struct CallableHelper : SignatureHelper<Callable> {};
+
+template<typename Callable, typename... Context>
+struct CallableHelper<Callable, std::tuple<Context...>,
+                      std::enable_if_t<!HasSignature<Callable>::value && (sizeof...(Context) > 0) &&
+                                       std::is_invocable_v<Callable, Context...>>>
+        : CallableDetails<std::invoke_result_t<Callable, Context...>, Context...> {};
 
 /**
  * @ingroup Details
@@ -127,28 +229,68 @@ template <typename Ret, typename... Args>
 struct FunctionFromTupleImpl<Ret, std::tuple<Args...>> {
     using FunctionType = std::function<Ret(Args...)>;
 };
-} // namespace details
 
 /**
- * @ingroup Function
+ * @ingroup Details
  *
- * Template class that allows extracting information about a callable type (a function,
- * a lambda, a functor etc.).
- * It provides the callable return type, the number and types of arguments.
- * @tparam Callable Callable type to inspect
+ * Helper struct that wraps a generic callable into a closure whose call operator
+ * has the exact signature described by the provided return type and tuple.
+ * @tparam Ret
+ * @tparam Tuple
  */
-template<typename Callable>
-struct Info : details::CallableHelper<decltype(std::function{std::declval<std::decay_t<Callable>>()})> {};
+template <typename Ret, typename Tuple>
+struct ClosureFromTupleImpl;
+
+/**
+ * @ingroup Details
+ *
+ * Specialization for tuple with variadic arguments
+ * @tparam Ret
+ * @tparam Args
+ */
+template <typename Ret, typename... Args>
+struct ClosureFromTupleImpl<Ret, std::tuple<Args...>> {
+    template <typename Body>
+    class Closure {
+    public:
+        using CallSignature = CallableDetails<Ret, Args...>;
+
+        explicit Closure(Body body) : _body{std::move(body)} {}
+
+        Ret operator()(Args... args) const& {
+            return _body(std::forward<Args>(args)...);
+        }
+
+        /// Last call of the closure: the body, and what it captured, can be moved into the call
+        Ret operator()(Args... args) && {
+            return std::move(_body)(std::forward<Args>(args)...);
+        }
+
+    private:
+        Body _body;
+    };
+
+    template <typename Body>
+    static decltype(auto) make(Body&& body) {
+        return Closure<std::decay_t<Body>>(std::forward<Body>(body));
+    }
+};
+} // namespace details
 
 /**
  * @ingroup Function
  *
- * Specialization for STL function
- * @tparam Ret function return type
- * @tparam Args function argument types
+ * Template class that allows extracting information about a callable type (a function,
+ * a lambda, a functor, a pointer to member etc.), without instantiating std::function.
+ * It provides the callable return type, the number and types of arguments.
+ * Pointers to members take the object as their first argument, as in std::invoke.
+ * Generic lambdas and overloaded function objects have no single signature; for those, the
+ * argument types they are going to be invoked with can be provided as Context.
+ * @tparam Callable Callable type to inspect
+ * @tparam Context argument types used when the callable has no single signature
  */
-template<typename Ret, typename ...Args>
-struct Info<std::function<Ret(Args...)>> : details::CallableHelper<std::function<Ret(Args...)>> {};
+template<typename Callable, typename ...Context>
+struct Info : details::CallableHelper<std::decay_t<Callable>, std::tuple<Context...>> {};
 
 /**
  * @ingroup Function
@@ -160,8 +302,254 @@ struct Info<std::function<Ret(Args...)>> : details::CallableHelper<std::function
  */
 template <typename Ret, typename Tuple>
 using FunctionFromTuple = typename details::FunctionFromTupleImpl<Ret, Tuple>::FunctionType;
+
+/**
+ * @ingroup Function
+ *
+ * Wraps given generic callable into a concrete closure type whose call operator
+ * takes the expanded tuple as input arguments and returns Ret.
+ * Unlike FunctionFromTuple, no type erasure takes place, so calls can be inlined.
+ * Calling an rvalue closure invokes the body as an rvalue, see BoundCall.
+ * @tparam Ret closure return type
+ * @tparam Tuple Tuple that contains the closure arguments
+ * @tparam Body generic callable type
+ * @param body generic callable invoked with the closure arguments
+ * @return closure with the exact signature Ret(Args...)
+ */
+template <typename Ret, typename Tuple, typename Body>
+decltype(auto) make_closure(Body&& body) {
+    return details::ClosureFromTupleImpl<Ret, Tuple>::make(std::forward<Body>(body));
+}
+
+/**
+ * @ingroup Function
+ *
+ * Invokes given callable with the provided arguments. Same as std::invoke, except
+ * that it is usable in constant expressions already in C++17 (std::invoke is only
+ * constexpr since C++20). Pointers to members are delegated to std::invoke.
+ * @tparam Callable callable type
+ * @tparam Args argument types
+ * @param callable callable to invoke
+ * @param args arguments to pass to the callable
+ * @return result of the invocation
+ */
+template <typename Callable, typename ...Args>
+constexpr decltype(auto) invoke(Callable&& callable, Args&& ...args) {
+    if constexpr (std::is_member_pointer_v<std::decay_t<Callable>>) {
+        return std::invoke(std::forward<Callable>(callable), std::forward<Args>(args)...);
+    } else {
+        return std::forward<Callable>(callable)(std::forward<Args>(args)...);
+    }
+}
+
+/**
+ * @ingroup Function
+ *
+ * Passes a stored value to given callable type without copying it when possible.
+ * If the callable accepts a const reference, the stored value is passed by reference,
+ * otherwise (e.g, callable takes an rvalue reference) a copy is passed.
+ * @tparam Callable callable type that will receive the value
+ * @tparam T stored value type
+ * @param value stored value
+ * @return reference to the value or a copy of it
+ */
+template <typename Callable, typename T>
+constexpr decltype(auto) pass_stored(const T& value) {
+    if constexpr (std::is_invocable_v<std::decay_t<Callable>, const T&>) {
+        return value;
+    } else {
+        return T(value);
+    }
+}
+
+/**
+ * @ingroup Function
+ *
+ * Argument bound inside a closure, e.g, by curry or partial. Calls of an lvalue closure keep it:
+ * it is passed by reference when the callable takes an lvalue reference and copied otherwise.
+ * The call of an rvalue closure is its last one, so the argument is moved into the callable.
+ * Move-only arguments can only be passed that way, unless the callable takes them by lvalue reference.
+ * @tparam T type of the bound argument
+ */
+template<typename T>
+class BoundArg {
+public:
+    explicit BoundArg(T value) : _value{std::move(value)} {}
+
+    /**
+     * Passes the argument to a parameter declared as Declared, keeping it for later calls
+     * @tparam Declared declared type of the parameter
+     * @return reference to the argument or a copy of it
+     */
+    template<typename Declared>
+    decltype(auto) pass() const& {
+        static_assert(std::is_lvalue_reference_v<Declared> || std::is_copy_constructible_v<T>,
+                      "Move-only bound arguments can only be passed once, call the closure as an rvalue");
+        if constexpr (std::is_lvalue_reference_v<Declared>) {
+            return static_cast<const T&>(_value);
+        } else {
+            return T(_value);
+        }
+    }
+
+    /**
+     * Passes the argument to a parameter declared as Declared for the last time
+     * @tparam Declared declared type of the parameter
+     * @return reference to the argument, an rvalue one unless Declared is an lvalue reference
+     */
+    template<typename Declared>
+    decltype(auto) pass() && {
+        if constexpr (std::is_lvalue_reference_v<Declared>) {
+            return static_cast<T&>(_value);
+        } else {
+            return std::move(_value);
+        }
+    }
+
+private:
+    T _value;
+};
+
+/**
+ * @ingroup Function
+ *
+ * Callable with its leading arguments bound, the body of the closures returned by curry and partial.
+ * Calling it as an rvalue moves the callable and the bound arguments into the call, so chains of
+ * temporaries, like curry(f)(a)(b), pass every argument along without copying it.
+ * @tparam Callable callable type
+ * @tparam DeclaredArgs tuple with the declared argument types of the callable
+ * @tparam Bound types of the bound arguments
+ */
+template <typename Callable, typename DeclaredArgs, typename ...Bound>
+class BoundCall {
+public:
+    explicit BoundCall(Callable callable, Bound ...bound) : _callable{std::move(callable)}, _bound{BoundArg<Bound>(std::move(bound))...} {}
+
+    template <typename ...Args>
+    decltype(auto) operator()(Args&& ...args) const& {
+        return call(_callable, _bound, std::index_sequence_for<Bound...>{}, std::forward<Args>(args)...);
+    }
+
+    template <typename ...Args>
+    decltype(auto) operator()(Args&& ...args) && {
+        return call(std::move(_callable), std::move(_bound), std::index_sequence_for<Bound...>{}, std::forward<Args>(args)...);
+    }
+
+private:
+    template <typename Self, typename BoundTuple, std::size_t ...Is, typename ...Args>
+    static decltype(auto) call(Self&& callable, BoundTuple&& bound, std::index_sequence<Is...>, Args&& ...args) {
+        return function::invoke(std::forward<Self>(callable),
+                                std::get<Is>(std::forward<BoundTuple>(bound)).template pass<std::tuple_element_t<Is, DeclaredArgs>>()...,
+                                std::forward<Args>(args)...);
+    }
+
+    Callable _callable;
+    std::tuple<BoundArg<Bound>...> _bound;
+};
+
+namespace details {
+template <typename Declared, typename Arg>
+constexpr decltype(auto) unwrap(Arg&& arg) {
+    if constexpr (std::is_rvalue_reference_v<Declared> && !std::is_rvalue_reference_v<Arg&&>) {
+        return std::decay_t<Declared>(*arg);
+    } else {
+        return *std::forward<Arg>(arg);
+    }
+}
+
+template <typename DeclaredArgs, typename Callable, std::size_t ...Is, typename ...Args>
+constexpr decltype(auto) invoke_unwrapped_impl(Callable&& callable, std::index_sequence<Is...>, Args&& ...args) {
+    return std::invoke(std::forward<Callable>(callable),
+                       unwrap<std::tuple_element_t<Is, DeclaredArgs>>(std::forward<Args>(args))...);
+}
+} // namespace details
+
+/**
+ * @ingroup Function
+ *
+ * Invokes given callable with the values held by the given wrappers (Maybe, Either, ...),
+ * without building any intermediate tuple. Values are passed by reference, forwarding the
+ * value category of each wrapper. A copy is only made when the callable declares an rvalue
+ * reference parameter and the wrapper is an lvalue.
+ * The wrappers must all hold a value, as they are accessed unchecked.
+ * @tparam DeclaredArgs tuple with the declared argument types of the callable
+ * @tparam Callable callable type
+ * @tparam Args wrapper types
+ * @param callable callable to invoke
+ * @param args wrappers holding the values to pass to the callable
+ * @return result of the invocation
+ */
+template <typename DeclaredArgs, typename Callable, typename ...Args>
+constexpr decltype(auto) invoke_unwrapped(Callable&& callable, Args&& ...args) {
+    return details::invoke_unwrapped_impl<DeclaredArgs>(std::forward<Callable>(callable), std::index_sequence_for<Args...>{},
+                                                        std::forward<Args>(args)...);
+}
 } // namespace function
 
+/**
+ * @ingroup Range
+ * Yafl Range traits, used by the algorithms that collect the values of a range
+ */
+namespace range {
+
+namespace details {
+template <typename Range, typename = void>
+struct HasSize : std::false_type {};
+
+template <typename Range>
+struct HasSize<Range, std::void_t<decltype(std::size(std::declval<const Range&>()))>> : std::true_type {};
+
+template <typename Range>
+using IteratorCategory = typename std::iterator_traits<decltype(std::begin(std::declval<Range&>()))>::iterator_category;
+} // namespace details
+
+/**
+ * @ingroup Range
+ *
+ * Passes an element of a range along, moving it when the range itself is an rvalue
+ * @tparam Range range type as deduced by a forwarding reference
+ * @tparam Element element type
+ * @param element element of the range
+ * @return element as lvalue if Range is an lvalue reference, otherwise as rvalue
+ */
+template <typename Range, typename Element>
+constexpr decltype(auto) forward_element(Element&& element) {
+    if constexpr (std::is_lvalue_reference_v<Range>) {
+        return static_cast<std::remove_reference_t<Element>&>(element);
+    } else {
+        return static_cast<std::remove_reference_t<Element>&&>(element);
+    }
+}
+
+/**
+ * @ingroup Range
+ *
+ * Element type of a range as obtained through forward_element
+ * @tparam Range range type as deduced by a forwarding reference
+ */
+template <typename Range>
+using ForwardedElement = decltype(forward_element<Range>(*std::begin(std::declval<Range&>())));
+
+/**
+ * @ingroup Range
+ *
+ * Reserves space in the given container for all the elements of the given range,
+ * when its size is known upfront (sized ranges or forward iterators)
+ * @tparam Container container type, must provide reserve
+ * @tparam Range range type
+ * @param container container to reserve
+ * @param range range whose elements will be added to the container
+ */
+template <typename Container, typename Range>
+void reserve(Container& container, const Range& range) {
+    if constexpr (details::HasSize<Range>::value) {
+        container.reserve(static_cast<typename Container::size_type>(std::size(range)));
+    } else if constexpr (std::is_base_of_v<std::forward_iterator_tag, details::IteratorCategory<const Range>>) {
+        container.reserve(static_cast<typename Container::size_type>(std::distance(std::begin(range), std::end(range))));
+    }
+}
+} // namespace range
+
 /**
  * @ingroup Tuple
  * Yafl Tuple traits
@@ -224,41 +612,27 @@ namespace details {
 /**
  * @ingroup Details
  *
- * Helper class that enables to check whether a tuple is a subset of another tuple.
- * It is a recursive function and this implementation is related with the generic case
- * @tparam Index last used index
+ * Helper class that enables to check whether a tuple is a prefix (subset) of another tuple.
+ * All element types are compared at once through a fold expression over the indices of Tuple2,
+ * so the instantiation depth does not depend on the tuple size.
  * @tparam Tuple1 Original tuple type
  * @tparam Tuple2 Subset tuple type
- * @tparam IsValid Control recursion
+ * @tparam Indices Indices of Tuple2
  */
-template<std::size_t Index, typename Tuple1, typename Tuple2, bool IsValid>
-struct IsTupleSubsetImpl {
-    static constexpr std::size_t index = std::tuple_size_v<Tuple2>;
+template<typename Tuple1, typename Tuple2, typename Indices = std::make_index_sequence<std::tuple_size_v<Tuple2>>>
+struct IsTupleSubsetImpl;
+
+template<typename Tuple1, typename Tuple2, std::size_t ...Is>
+struct IsTupleSubsetImpl<Tuple1, Tuple2, std::index_sequence<Is...>> {
+    static constexpr std::size_t index = sizeof...(Is);
     static constexpr bool value = []() {
-        if constexpr (std::tuple_size_v<Tuple2> == 0) {
-            return true;
+        if constexpr (sizeof...(Is) > std::tuple_size_v<Tuple1>) {
+            return false;
         } else {
-            return (Index < std::tuple_size_v<Tuple2>) &&
-                   compareTupleTypeByIndex<Index, Tuple1, Tuple2>() &&
-                   IsTupleSubsetImpl<Index + 1, Tuple1, Tuple2, (Index + 1 < std::tuple_size_v<Tuple2>)>::value;
+            return (compareTupleTypeByIndex<Is, Tuple1, Tuple2>() && ...);
         }
     }();
 };
-
-/**
- * @ingroup Details
- *
- * Helper class that enables to check whether a tuple is a subset of another tuple.
- * It is a recursive function and this implementation is related with the end condition.
- * @tparam Index last used index
- * @tparam Tuple1 Original tuple type
- * @tparam Tuple2 Subset tuple type
- */
-template<std::size_t Index, typename Tuple1, typename Tuple2>
-struct IsTupleSubsetImpl<Index, Tuple1, Tuple2, false> {
-    static constexpr bool value = true;
-    static constexpr std::size_t index = std::tuple_size_v<Tuple2>;
-};
 } // namespace details
 
 /**
@@ -270,7 +644,7 @@ struct IsTupleSubsetImpl<Index, Tuple1, Tuple2, false> {
  * @tparam Tuple2 Subset tuple type
  */
 template <typename Tuple1, typename Tuple2>
-struct IsTupleSubset : details::IsTupleSubsetImpl<0, Tuple1, Tuple2, true>{};
+struct IsTupleSubset : details::IsTupleSubsetImpl<Tuple1, Tuple2>{};
 
 namespace details {
 
@@ -278,40 +652,18 @@ namespace details {
  * @ingroup Details
  *
  * Helper class that enables the creation of a tuple type that is a subset of a given tuple
- * Subset is created starting from the given index.
- * This templated class is recursive and this implementation is related with the recursion body. It defines
- * a new type NewSubsetTuple that contains the tuple subset type.
- * @tparam Index last used index
- * @tparam Tuple original tuple type
- * @tparam SubsetTuple updated type
- * @tparam IsValid controls execution of the recursive function
- */
-template <std::size_t Index, typename Tuple, typename SubsetTuple, bool IsValid>
-struct CreateSubsetTupleFromIndex {
-    using CurrentElementType = std::tuple_element_t<Index, Tuple>;
-
-    using NewSubsetTuple = typename CreateSubsetTupleFromIndex<
-            Index + 1,
-            Tuple,
-            decltype(std::tuple_cat(std::declval<SubsetTuple>(), std::make_tuple(CurrentElementType()))),
-            (Index + 1 < std::tuple_size_v<Tuple>)>::NewSubsetTuple;
-};
-
-/**
- * @ingroup Details
- *
- * Helper class that enables the creation of a tuple type that is a subset of a given tuple
- * Subset is created starting from the given index.
- * This templated class is recursive and this implementation is related with the recursion end condition.
- * It is a specialization using IsValid type as false. It defines a new type NewSubsetTuple that contains
- * the tuple subset type.
- * @tparam Index last used index
+ * Subset is created starting from the given index, by expanding the remaining indices in a single
+ * pack expansion. Element types are taken as they are, they do not need to be default constructible.
+ * @tparam Index first index of the subset
  * @tparam Tuple original tuple type
- * @tparam SubsetTuple created type
+ * @tparam Indices offsets of the subset elements
  */
-template <std::size_t Index, typename Tuple, typename SubsetTuple>
-struct CreateSubsetTupleFromIndex<Index, Tuple, SubsetTuple, false> {
-    using NewSubsetTuple = SubsetTuple;
+template <std::size_t Index, typename Tuple, typename Indices = std::make_index_sequence<std::tuple_size_v<Tuple> - Index>>
+struct CreateSubsetTupleFromIndex;
+
+template <std::size_t Index, typename Tuple, std::size_t ...Is>
+struct CreateSubsetTupleFromIndex<Index, Tuple, std::index_sequence<Is...>> {
+    using NewSubsetTuple = std::tuple<std::tuple_element_t<Index + Is, Tuple>...>;
 };
 } // namespace details
 
@@ -323,7 +675,7 @@ struct CreateSubsetTupleFromIndex<Index, Tuple, SubsetTuple, false> {
  * @tparam Tuple tuple to extract subset
  */
 template <std::size_t Index, typename Tuple>
-using TupleSubset = typename details::CreateSubsetTupleFromIndex<Index, Tuple, std::tuple<>, true>::NewSubsetTuple;
+using TupleSubset = typename details::CreateSubsetTupleFromIndex<Index, Tuple>::NewSubsetTuple;
 }
 
 /**
@@ -381,6 +733,20 @@ struct DomainDetailsImpl {
 template<typename T>
 struct DomainTypeInfo : public details::DomainDetailsImpl<std::decay_t<T>>{};
 
+/**
+ * @ingroup Type
+ *
+ * Checks whether type T is an asynchronous Yafl type, i.e, its value may only be available later,
+ * so it has to be chained with bind instead of being inspected. Types opt in with an isAsync flag
+ * in their DomainDetailsImpl specialization.
+ * @tparam T Type to check
+ */
+template<typename T, typename = void>
+struct IsAsync : std::false_type {};
+
+template<typename T>
+struct IsAsync<T, std::void_t<decltype(DomainTypeInfo<T>::isAsync)>> : std::bool_constant<DomainTypeInfo<T>::isAsync> {};
+
 /**
  * @ingroup Type
  *
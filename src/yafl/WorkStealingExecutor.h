@@ -0,0 +1,435 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ * \defgroup    Executor Executors
+ *
+ * Work-stealing thread pool. Every worker owns a Chase-Lev deque: tasks submitted from a worker
+ * are pushed to and popped from the bottom of its own deque (LIFO, cache friendly), while idle
+ * workers steal from the top of the others (FIFO). Tasks submitted from other threads go through
+ * a lock-free bounded injection queue. Workers with nothing to do park on an event count, with a
+ * futex on Linux and a condition variable elsewhere, so idle pools do not burn CPU.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "yafl/Assert.h"
+#include "yafl/Executor.h"
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace yafl {
+namespace executor {
+namespace details {
+
+/// Size used to keep atomics written by different threads on different cache lines
+constexpr std::size_t CacheLineSize = 64;
+
+/// Unit of work stored in the queues
+using Task = std::function<void()>;
+
+/**
+ * @ingroup Details
+ *
+ * Chase-Lev work-stealing deque, with the memory orderings of "Correct and Efficient Work-Stealing
+ * for Weak Memory Models" (Lê et al.). Only the owner pushes and pops, at the bottom; any thread
+ * steals, at the top. The ring buffer doubles when full; retired buffers are kept until destruction,
+ * since a thief may still be reading them.
+ */
+template <typename T>
+class WorkStealingDeque {
+    struct Buffer {
+        explicit Buffer(std::int64_t size) : capacity{size}, slots{new std::atomic<T>[static_cast<std::size_t>(size)]} {}
+
+        T get(std::int64_t index) const {
+            return slots[static_cast<std::size_t>(index & (capacity - 1))].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, T item) {
+            slots[static_cast<std::size_t>(index & (capacity - 1))].store(item, std::memory_order_relaxed);
+        }
+
+        std::int64_t capacity;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+public:
+    explicit WorkStealingDeque(std::int64_t capacity = 256) {
+        YAFL_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0, "capacity must be a power of two");
+        _buffers.push_back(std::make_unique<Buffer>(capacity));
+        _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /// Owner only
+    void push(T item) {
+        const std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = _top.load(std::memory_order_acquire);
+        Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+        if (bottom - top > buffer->capacity - 1) {
+            buffer = grow(buffer, top, bottom);
+        }
+        buffer->put(bottom, item);
+        // release store instead of the paper's release fence: same code on x86, and visible to sanitizers
+        _bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    /// Owner only, returns nullptr when empty
+    T pop() {
+        const std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = _top.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T item = buffer->get(bottom);
+        if (top == bottom) {
+            // last element, race against thieves
+            if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /// Any thread, returns nullptr when empty or when another thread won the race
+    T steal() {
+        std::int64_t top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = _bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        T item = _buffer.load(std::memory_order_acquire)->get(top);
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    /// Any thread, approximate
+    [[nodiscard]] bool empty() const {
+        return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+    }
+
+private:
+    Buffer* grow(Buffer* buffer, std::int64_t top, std::int64_t bottom) {
+        auto bigger = std::make_unique<Buffer>(buffer->capacity * 2);
+        for (std::int64_t index = top; index < bottom; ++index) {
+            bigger->put(index, buffer->get(index));
+        }
+        _buffers.push_back(std::move(bigger));
+        _buffer.store(_buffers.back().get(), std::memory_order_release);
+        return _buffers.back().get();
+    }
+
+    alignas(CacheLineSize) std::atomic<std::int64_t> _top{0};
+    alignas(CacheLineSize) std::atomic<std::int64_t> _bottom{0};
+    alignas(CacheLineSize) std::atomic<Buffer*> _buffer{nullptr};
+    std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+/**
+ * @ingroup Details
+ *
+ * Bounded lock-free multi-producer multi-consumer queue (D. Vyukov). Every cell carries a sequence
+ * number telling producers and consumers whether it is free or holds an item for their position.
+ */
+template <typename T>
+class InjectionQueue {
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T item;
+    };
+
+public:
+    explicit InjectionQueue(std::size_t capacity) : _mask{capacity - 1}, _cells{new Cell[capacity]} {
+        YAFL_ASSERT(capacity > 1 && (capacity & (capacity - 1)) == 0, "capacity must be a power of two");
+        for (std::size_t index = 0; index < capacity; ++index) {
+            _cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    /// Returns false when full
+    bool push(T item) {
+        std::size_t position = _enqueue.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = _cells[position & _mask];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0) {
+                if (_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.item = item;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = _enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Returns nullptr when empty
+    T pop() {
+        std::size_t position = _dequeue.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = _cells[position & _mask];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (difference == 0) {
+                if (_dequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    T item = cell.item;
+                    cell.sequence.store(position + _mask + 1, std::memory_order_release);
+                    return item;
+                }
+            } else if (difference < 0) {
+                return nullptr;
+            } else {
+                position = _dequeue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Any thread, approximate
+    [[nodiscard]] bool empty() const {
+        return _enqueue.load(std::memory_order_relaxed) == _dequeue.load(std::memory_order_relaxed);
+    }
+
+private:
+    const std::size_t _mask;
+    std::unique_ptr<Cell[]> _cells;
+    alignas(CacheLineSize) std::atomic<std::size_t> _enqueue{0};
+    alignas(CacheLineSize) std::atomic<std::size_t> _dequeue{0};
+};
+
+/**
+ * @ingroup Details
+ *
+ * Event count used to park idle workers. A worker reads the epoch, checks for work once more and
+ * sleeps only if the epoch did not change meanwhile, so a notification between the check and the
+ * sleep is never lost. Uses a futex on Linux and a condition variable elsewhere.
+ */
+class Parker {
+public:
+    [[nodiscard]] std::uint32_t epoch() const {
+        return _epoch.load(std::memory_order_seq_cst);
+    }
+
+    void wait(std::uint32_t epoch) {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&_epoch), FUTEX_WAIT_PRIVATE, epoch, nullptr, nullptr, 0);
+#else
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [&]() { return _epoch.load(std::memory_order_seq_cst) != epoch; });
+#endif
+    }
+
+    void notify(int count) {
+        _epoch.fetch_add(1, std::memory_order_seq_cst);
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&_epoch), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#else
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (count == 1) {
+            _condition.notify_one();
+        } else {
+            _condition.notify_all();
+        }
+#endif
+    }
+
+private:
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "futex needs a plain 32 bit word");
+    std::atomic<std::uint32_t> _epoch{0};
+#if !defined(__linux__)
+    std::mutex _mutex;
+    std::condition_variable _condition;
+#endif
+};
+} // namespace details
+
+/**
+ * @ingroup Executor
+ *
+ * Work-stealing thread pool. Tasks submitted from one of its workers (e.g, continuations of a
+ * Future completed by a task of the pool) go to that worker's own deque and never touch shared
+ * queues unless stolen; tasks submitted from other threads go through the injection queue.
+ * When the injection queue is full, external submitters yield until workers make room.
+ *
+ * Tasks must not throw. The destructor runs all the pending tasks before joining the workers.
+ */
+class WorkStealingExecutor final : public Executor {
+    struct Worker {
+        details::WorkStealingDeque<details::Task*> deque;
+        std::thread thread;
+    };
+
+public:
+    /**
+     * Constructor, starts the workers
+     * @param threads number of workers, 0 uses the hardware concurrency
+     * @param injectionCapacity capacity of the queue of tasks submitted from outside the pool, a power of two
+     */
+    explicit WorkStealingExecutor(std::size_t threads = 0, std::size_t injectionCapacity = 1 << 16)
+            : _injection{injectionCapacity} {
+        if (threads == 0) {
+            threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        _workers.reserve(threads);
+        for (std::size_t index = 0; index < threads; ++index) {
+            _workers.push_back(std::make_unique<Worker>());
+        }
+        try {
+            for (std::size_t index = 0; index < threads; ++index) {
+                _workers[index]->thread = std::thread([this, index]() { run(index); });
+            }
+        } catch (...) {
+            // the workers already started must not outlive the pool that failed to construct
+            stop();
+            throw;
+        }
+    }
+
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    /**
+     * Destructor, runs the pending tasks and joins the workers
+     */
+    ~WorkStealingExecutor() override {
+        stop();
+    }
+
+    /**
+     * Submits a task
+     * @param task task to run on one of the workers
+     */
+    void execute(std::function<void()> task) override {
+        auto* pending = new details::Task(std::move(task));
+        if (current().pool == this) {
+            _workers[current().index]->deque.push(pending);
+        } else {
+            while (!_injection.push(pending)) {
+                std::this_thread::yield();
+            }
+        }
+        // pairs with the fence of park: either the parking worker sees the task or we see it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleeping.load(std::memory_order_relaxed) > 0) {
+            _parker.notify(1);
+        }
+    }
+
+    /**
+     * Number of workers
+     * @return number of threads of the pool
+     */
+    [[nodiscard]] std::size_t size() const { return _workers.size(); }
+
+private:
+    struct CurrentWorker {
+        const WorkStealingExecutor* pool = nullptr;
+        std::size_t index = 0;
+    };
+
+    static CurrentWorker& current() {
+        thread_local CurrentWorker worker;
+        return worker;
+    }
+
+    /// Runs the pending tasks and joins the workers that were started
+    void stop() {
+        _stopping.store(true, std::memory_order_seq_cst);
+        _parker.notify(static_cast<int>(_workers.size()));
+        for (auto& worker : _workers) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+    }
+
+    void run(std::size_t index) {
+        current() = CurrentWorker{this, index};
+        for (;;) {
+            if (details::Task* task = next(index)) {
+                (*task)();
+                delete task;
+            } else if (!park()) {
+                return;
+            }
+        }
+    }
+
+    details::Task* next(std::size_t index) {
+        if (details::Task* task = _workers[index]->deque.pop()) {
+            return task;
+        }
+        if (details::Task* task = _injection.pop()) {
+            return task;
+        }
+        // steal from the other workers, starting at the next one to spread the thieves
+        for (std::size_t offset = 1; offset < _workers.size(); ++offset) {
+            if (details::Task* task = _workers[(index + offset) % _workers.size()]->deque.steal()) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] bool hasWork() const {
+        if (!_injection.empty()) {
+            return true;
+        }
+        return std::any_of(_workers.begin(), _workers.end(), [](const auto& worker) { return !worker->deque.empty(); });
+    }
+
+    /// Returns false when the pool is stopping and there is no work left
+    bool park() {
+        _sleeping.fetch_add(1, std::memory_order_seq_cst);
+        const std::uint32_t epoch = _parker.epoch();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (hasWork()) {
+            _sleeping.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        if (_stopping.load(std::memory_order_seq_cst)) {
+            // no queued work left: tasks still running push their children to their own deques
+            _sleeping.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        _parker.wait(epoch);
+        _sleeping.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    details::InjectionQueue<details::Task*> _injection;
+    details::Parker _parker;
+    alignas(details::CacheLineSize) std::atomic<std::size_t> _sleeping{0};
+    std::atomic<bool> _stopping{false};
+};
+
+} // namespace executor
+} // namespace yafl
@@ -0,0 +1,20 @@
+/**
+ * \brief       Forward declarations of the YAFL types, for interface headers that only name them
+ *              (function declarations, pointers and references) and do not need their definitions
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+#pragma once
+
+namespace yafl {
+
+/// Defined in yafl/Maybe.h
+template <typename>
+class Maybe;
+
+/// Defined in yafl/Either.h
+template <typename Error, typename Value>
+class Either;
+
+} // namespace yafl
@@ -0,0 +1,133 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Coroutine.h"
+#include "yafl/Either.h"
+#include "yafl/Maybe.h"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace yafl;
+
+namespace {
+/// Counts live instances to check that short-circuited frames release their locals
+struct Tracked {
+    explicit Tracked(int& live) : _live(live) { ++_live; }
+    ~Tracked() { --_live; }
+    Tracked(const Tracked&) = delete;
+    Tracked& operator=(const Tracked&) = delete;
+
+    int& _live;
+};
+
+Either<std::string, int> safeDivide(int dividend, int divisor) {
+    if (divisor == 0) {
+        return Either<std::string, int>::Error("division by zero");
+    }
+    return Either<std::string, int>::Ok(dividend / divisor);
+}
+
+Maybe<int> sum(const Maybe<int>& a, int b) {
+    auto x = co_await a;
+    auto y = co_await safeDivide(x, b);
+    co_return x + y;
+}
+
+Either<std::string, int> divideAll(int value, int first, int second) {
+    auto x = co_await safeDivide(value, first);
+    auto y = co_await safeDivide(x, second);
+    co_return y;
+}
+
+Maybe<int> nested(const Maybe<int>& a, int depth) {
+    if (depth == 0) {
+        co_return co_await a;
+    }
+    auto inner = co_await nested(a, depth - 1);
+    co_return inner + 1;
+}
+}
+
+TEST(Coroutine, validate_maybe_do_notation) {
+    EXPECT_EQ(sum(Maybe<int>::Just(10), 2), Maybe<int>::Just(15));
+    EXPECT_FALSE(sum(Maybe<int>::Nothing(), 2).hasValue());
+    EXPECT_FALSE(sum(Maybe<int>::Just(10), 0).hasValue());
+    EXPECT_EQ(nested(Maybe<int>::Just(1), 100), Maybe<int>::Just(101));
+    EXPECT_FALSE(nested(Maybe<int>::Nothing(), 100).hasValue());
+}
+
+TEST(Coroutine, validate_either_do_notation) {
+    EXPECT_EQ(divideAll(100, 5, 2), (Either<std::string, int>::Ok(10)));
+    EXPECT_EQ(divideAll(100, 0, 2).error(), "division by zero");
+    EXPECT_EQ(divideAll(100, 5, 0).error(), "division by zero");
+
+    auto explicitError = []() -> Either<std::string, int> {
+        co_return Either<std::string, int>::Error("explicit");
+    };
+    EXPECT_EQ(explicitError().error(), "explicit");
+}
+
+TEST(Coroutine, validate_void_types) {
+    auto check = [](bool ok) -> Either<int, void> {
+        if (!ok) {
+            co_await Either<int, void>::Error(42);
+        }
+        co_return;
+    };
+    EXPECT_TRUE(check(true).isOk());
+    EXPECT_EQ(check(false).error(), 42);
+
+    auto maybe = [](const Maybe<void>& guard) -> Maybe<int> {
+        co_await guard;
+        co_return 1;
+    };
+    EXPECT_EQ(maybe(Maybe<void>::Just()), Maybe<int>::Just(1));
+    EXPECT_FALSE(maybe(Maybe<void>::Nothing()).hasValue());
+}
+
+TEST(Coroutine, validate_move_only_values) {
+    auto unwrap = [](Maybe<std::unique_ptr<int>> value) -> Maybe<int> {
+        auto pointer = co_await std::move(value);
+        co_return *pointer;
+    };
+    EXPECT_EQ(unwrap(Maybe<std::unique_ptr<int>>::Just(std::make_unique<int>(7))), Maybe<int>::Just(7));
+    EXPECT_FALSE(unwrap(Maybe<std::unique_ptr<int>>::Nothing()).hasValue());
+}
+
+TEST(Coroutine, validate_short_circuit_destroys_frame) {
+    int live = 0;
+    bool resumed = false;
+    auto body = [&live, &resumed](const Maybe<int>& value) -> Maybe<int> {
+        Tracked tracked(live);
+        auto x = co_await value;
+        resumed = true;
+        co_return x;
+    };
+
+    EXPECT_FALSE(body(Maybe<int>::Nothing()).hasValue());
+    EXPECT_FALSE(resumed);
+    EXPECT_EQ(live, 0);
+
+    EXPECT_EQ(body(Maybe<int>::Just(3)), Maybe<int>::Just(3));
+    EXPECT_TRUE(resumed);
+    EXPECT_EQ(live, 0);
+}
+
+TEST(Coroutine, validate_exceptions_propagate) {
+    auto throwing = [](const Maybe<int>& value) -> Maybe<int> {
+        auto x = co_await value;
+        if (x < 0) {
+            throw std::invalid_argument("negative");
+        }
+        co_return x;
+    };
+    EXPECT_THROW(static_cast<void>(throwing(Maybe<int>::Just(-1))), std::invalid_argument);
+    EXPECT_EQ(throwing(Maybe<int>::Just(1)), Maybe<int>::Just(1));
+}
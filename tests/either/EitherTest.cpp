@@ -7,6 +7,12 @@
 
 #include "yafl/HOF.h"
 #include "yafl/Either.h"
+#include "TestHelpers.h"
+#include <memory>
+#include <string>
+#include <list>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -894,3 +900,388 @@ TEST(EitherTest, validate_lift) {
         ASSERT_EQ(result6.error(), 1);
     }
 }
+
+namespace {
+enum class Color : unsigned char { Red, Green, Blue };
+} // namespace
+
+template <>
+struct yafl::type::Niche<Color> {
+    static constexpr bool hasNiche = true;
+    static constexpr Color value = static_cast<Color>(0xFF);
+};
+
+namespace {
+struct Slot {
+    int index;
+
+    constexpr bool operator==(const Slot& other) const { return index == other.index; }
+};
+} // namespace
+
+template <>
+struct yafl::type::Niche<Slot> {
+    static constexpr bool hasNiche = true;
+    static constexpr Slot value{-1};
+};
+
+// Instantiates every non template member of the niche storage specialization
+template class yafl::Either<void, Slot>;
+
+using test::CopyMoveCounter;
+using test::Pinned;
+
+TEST(EitherTest, validate_rvalue_chain_moves_value) {
+    {
+        using EitherType = Either<int, CopyMoveCounter>;
+        CopyMoveCounter::reset();
+        const auto result = EitherType::Ok(CopyMoveCounter{})
+                .fmap([](CopyMoveCounter c) { return c; })
+                .bind([](CopyMoveCounter c) { return EitherType::Ok(std::move(c)); })
+                .fmap([](CopyMoveCounter&& c) { return std::move(c); })
+                .bind([](CopyMoveCounter c) { return EitherType::Ok(std::move(c)); })
+                .fmap([](CopyMoveCounter c) { return c; });
+        ASSERT_TRUE(result.isOk());
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+        ASSERT_GT(CopyMoveCounter::moves, 0);
+    }
+    {
+        using EitherType = Either<void, CopyMoveCounter>;
+        CopyMoveCounter::reset();
+        const auto result = EitherType::Ok(CopyMoveCounter{})
+                .fmap([](CopyMoveCounter c) { return c; })
+                .bind([](CopyMoveCounter c) { return EitherType::Ok(std::move(c)); })
+                .fmap([](CopyMoveCounter&& c) { return std::move(c); })
+                .bind([](CopyMoveCounter c) { return EitherType::Ok(std::move(c)); })
+                .fmap([](CopyMoveCounter c) { return c; });
+        ASSERT_TRUE(result.isOk());
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+    }
+    {
+        using EitherType = Either<CopyMoveCounter, int>;
+        CopyMoveCounter::reset();
+        const auto result = EitherType::Error(CopyMoveCounter{})
+                .fmap([](int i) { return i * 2; })
+                .bind([](int i) { return EitherType::Ok(i); })
+                .fmap([](int i) { return i + 1; })
+                .bind([](int i) { return EitherType::Ok(i); })
+                .fmap([](int i) { return i; });
+        ASSERT_TRUE(result.isError());
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+    }
+    {
+        using EitherType = Either<CopyMoveCounter, void>;
+        CopyMoveCounter::reset();
+        const auto result = EitherType::Error(CopyMoveCounter{})
+                .fmap([]() { return; })
+                .bind([]() { return EitherType::Ok(); })
+                .fmap([]() { return; })
+                .bind([]() { return EitherType::Ok(); })
+                .fmap([]() { return; });
+        ASSERT_TRUE(result.isError());
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+    }
+    {
+        using EitherType = Either<int, CopyMoveCounter>;
+        CopyMoveCounter::reset();
+        auto source = EitherType::Ok(CopyMoveCounter{});
+        std::ignore = std::move(source).value();
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+    }
+}
+
+TEST(EitherTest, validate_lift_returns_concrete_closure) {
+    const auto lifted = either::lift<int>([](int i, const std::string& s) { return s + std::to_string(i);});
+    using Signature = std::function<Either<int, std::string>(const Either<int, int>&, const Either<int, std::string>&)>;
+    ASSERT_FALSE((std::is_same_v<std::decay_t<decltype(lifted)>, Signature>));
+    ASSERT_TRUE((std::is_same_v<function::Info<decltype(lifted)>::Signature, Signature>));
+    ASSERT_EQ(lifted(either::Ok<int>(1), either::Ok<int, std::string>("dummy")).value(), "dummy1");
+}
+
+static_assert(sizeof(Either<int, int>) <= 8);
+static_assert(sizeof(Either<int, double>) <= 16);
+static_assert(sizeof(Either<void, int>) == sizeof(std::optional<int>));
+static_assert(sizeof(Either<int, void>) == sizeof(std::optional<int>));
+static_assert(sizeof(Either<void, Color>) == sizeof(Color));
+static_assert(sizeof(Either<Color, void>) == sizeof(Color));
+static_assert(sizeof(Either<void, Slot>) == sizeof(Slot));
+
+TEST(EitherTest, validate_niche_value_is_rejected) {
+    const auto niche = type::Niche<Color>::value;
+#if YAFL_ASSERTS_ENABLED
+    ASSERT_DEATH(std::ignore = (Either<void, Color>::Ok(niche)), "niche value cannot be stored");
+    ASSERT_DEATH(std::ignore = (Either<Color, void>::Error(niche)), "niche value cannot be stored");
+    ASSERT_DEATH(std::ignore = (Either<void, Slot>::Ok(type::Niche<Slot>::value)), "niche value cannot be stored");
+#endif
+    ASSERT_TRUE((Either<void, Color>::Ok(Color::Red).isOk()));
+    ASSERT_TRUE((Either<Color, void>::Error(Color::Blue).isError()));
+    ASSERT_NE(niche, Color::Red);
+}
+
+TEST(EitherTest, validate_lift_passes_references) {
+    using Counted = Either<std::string, CopyMoveCounter>;
+    const auto lifted = either::lift<std::string>([](const CopyMoveCounter& a, const CopyMoveCounter& b, int c) { return (&a != &b) ? c : 0; });
+    const auto a = Counted::Ok(std::in_place);
+    const auto b = Counted::Ok(std::in_place);
+    CopyMoveCounter::reset();
+    ASSERT_EQ(lifted(a, b, either::Ok<std::string>(1)).value(), 1);
+    ASSERT_EQ(CopyMoveCounter::copies, 0);
+    ASSERT_EQ(CopyMoveCounter::moves, 0);
+
+    const auto first = lifted(a, Counted::Error("first"), either::Error<std::string, int>("second"));
+    ASSERT_EQ(first.error(), "first");
+    const auto second = lifted(a, b, either::Error<std::string, int>("second"));
+    ASSERT_EQ(second.error(), "second");
+
+    const auto consuming = either::lift<void>([](std::string&& s) { return std::move(s) + "!"; });
+    const auto source = either::Ok<void, std::string>("dummy");
+    ASSERT_EQ(consuming(source).value(), "dummy!");
+    ASSERT_EQ(source.value(), "dummy");
+}
+
+TEST(EitherTest, validate_partial_apply_keeps_bound_argument) {
+    const auto func = [](std::string prefix, std::unique_ptr<int> p) { return prefix + std::to_string(*p); };
+    const auto partialApply = either::Ok<std::string>(func)(std::string("value"));
+    ASSERT_EQ(partialApply.value()(std::make_unique<int>(1)), "value1");
+    ASSERT_EQ(partialApply.value()(std::make_unique<int>(2)), "value2");
+
+    const auto partialApplyVoid = either::Ok<void>(func)(std::string("value"));
+    ASSERT_EQ(partialApplyVoid.value()(std::make_unique<int>(1)), "value1");
+    ASSERT_EQ(partialApplyVoid.value()(std::make_unique<int>(2)), "value2");
+}
+
+TEST(EitherTest, validate_niche_storage) {
+    const auto ok = Either<void, Color>::Ok(Color::Green);
+    const auto error = Either<void, Color>::Error();
+    EXPECT_TRUE(ok.isOk());
+    EXPECT_EQ(ok.value(), Color::Green);
+    EXPECT_TRUE(error.isError());
+    EXPECT_FALSE(ok == error);
+    EXPECT_EQ(ok.fmap([](Color c) { return c == Color::Green; }).value(), true);
+
+    const auto failed = Either<Color, void>::Error(Color::Blue);
+    EXPECT_TRUE(failed.isError());
+    EXPECT_EQ(failed.error(), Color::Blue);
+    EXPECT_TRUE((Either<Color, void>::Ok().isOk()));
+}
+
+TEST(EitherTest, validate_single_discriminant) {
+    const auto ok = Either<int, int>::Ok(3);
+    const auto error = Either<int, int>::Error(3);
+    EXPECT_TRUE(ok.isOk());
+    EXPECT_TRUE(error.isError());
+    EXPECT_FALSE(ok == error);
+    EXPECT_TRUE((ok == Either<int, int>::Ok(3)));
+    EXPECT_TRUE((error == Either<int, int>::Error(3)));
+}
+
+TEST(EitherTest, validate_in_place_construction) {
+    const auto ok = Either<int, Pinned>::Ok(std::in_place, 1, "dummy");
+    ASSERT_TRUE(ok.isOk());
+    const auto error = Either<Pinned, int>::Error(std::in_place, 2, "dummy");
+    ASSERT_TRUE(error.isError());
+    const auto void_ok = Either<void, Pinned>::Ok(std::in_place, 3, "dummy");
+    ASSERT_TRUE(void_ok.isOk());
+    const auto void_error = Either<Pinned, void>::Error(std::in_place, 4, "dummy");
+    ASSERT_TRUE(void_error.isError());
+
+    const auto free_ok = either::Ok<int, Pinned>(std::in_place, 5, "dummy");
+    ASSERT_TRUE(free_ok.isOk());
+    const auto free_error = either::Error<Pinned, int>(std::in_place, 6, "dummy");
+    ASSERT_TRUE(free_error.isError());
+
+    auto pointer = either::Ok<std::string>(std::make_unique<int>(7));
+    ASSERT_TRUE((std::is_same_v<decltype(pointer), Either<std::string, std::unique_ptr<int>>>));
+    ASSERT_TRUE(pointer.isOk());
+
+    CopyMoveCounter::reset();
+    const auto counter_ok = either::Ok<int>(CopyMoveCounter{});
+    const auto counter_error = either::Error<CopyMoveCounter, int>(CopyMoveCounter{});
+    const auto counter_void = either::Ok<void>(CopyMoveCounter{});
+    ASSERT_TRUE(counter_ok.isOk());
+    ASSERT_TRUE(counter_error.isError());
+    ASSERT_TRUE(counter_void.isOk());
+    ASSERT_EQ(CopyMoveCounter::copies, 0);
+
+    const std::string lvalue = "dummy";
+    ASSERT_EQ((either::Ok<int, std::string>(lvalue).value()), "dummy");
+    ASSERT_EQ((either::Error<std::string, int>(lvalue).error()), "dummy");
+}
+
+TEST(EitherTest, validate_move_only_payload) {
+    using Pointer = std::unique_ptr<int>;
+    const auto result = Either<std::string, Pointer>::Ok(std::make_unique<int>(1))
+            .fmap([](Pointer p) { *p += 1; return p; })
+            .bind([](Pointer p) { return Either<std::string, Pointer>::Ok(std::move(p)); })
+            .fmap([](const Pointer& p) { return *p; });
+    ASSERT_EQ(result.value(), 2);
+
+    const auto failed = Either<Pointer, int>::Error(std::make_unique<int>(3))
+            .fmap([](int i) { return i + 1; })
+            .bind([](int i) { return Either<Pointer, int>::Ok(i); });
+    ASSERT_TRUE(failed.isError());
+
+    auto source = Either<void, Pointer>::Ok(std::make_unique<int>(4));
+    ASSERT_EQ(source.fmap([](const Pointer& p) { return *p; }).value(), 4);
+    const Pointer extracted = std::move(source).value();
+    ASSERT_EQ(*extracted, 4);
+
+    ASSERT_EQ(*(Either<int, Pointer>::Error(0).valueOr(std::make_unique<int>(5))), 5);
+    ASSERT_EQ(*(Either<Pointer, int>::Error(std::make_unique<int>(6)).errorOr(nullptr)), 6);
+    ASSERT_EQ(*(Either<Pointer, void>::Error(std::make_unique<int>(7)).errorOr(nullptr)), 7);
+    ASSERT_EQ(*(Either<void, Pointer>::Ok(std::make_unique<int>(8)).valueOr(nullptr)), 8);
+
+    const auto lifted = either::lift<std::string>([](Pointer a, const Pointer& b) { return *a + *b; });
+    ASSERT_EQ(lifted(Either<std::string, Pointer>::Ok(std::make_unique<int>(9)),
+                     Either<std::string, Pointer>::Ok(std::make_unique<int>(10))).value(), 19);
+    ASSERT_EQ(lifted(Either<std::string, Pointer>::Ok(std::make_unique<int>(9)),
+                     Either<std::string, Pointer>::Error("failed")).error(), "failed");
+}
+
+TEST(EitherTest, validate_unchecked_accessors) {
+    auto ok = Either<int, std::string>::Ok("dummy");
+    ASSERT_EQ(*ok, "dummy");
+    ASSERT_EQ(ok->size(), 5U);
+    ASSERT_EQ(&ok.value_ref(), &*ok);
+    *ok += "1";
+    ASSERT_EQ(ok.value(), "dummy1");
+    const std::string moved = *std::move(ok);
+    ASSERT_EQ(moved, "dummy1");
+
+    const auto error = Either<std::string, int>::Error("failed");
+    ASSERT_EQ(error.error_ref(), "failed");
+    const auto void_ok = Either<void, std::string>::Ok("dummy");
+    ASSERT_EQ(void_ok->size(), 5U);
+    ASSERT_EQ(void_ok.value_ref(), "dummy");
+    const auto void_error = Either<std::string, void>::Error("failed");
+    ASSERT_EQ(void_error.error_ref(), "failed");
+    const auto niche = Either<void, Color>::Ok(Color::Blue);
+    ASSERT_EQ(*niche, Color::Blue);
+    auto slot = Either<void, Slot>::Ok(Slot{3});
+    ASSERT_EQ(slot->index, 3);
+    slot->index = 4;
+    ASSERT_EQ(std::as_const(slot)->index, 4);
+#if YAFL_ASSERTS_ENABLED
+    ASSERT_DEATH(std::ignore = error.value_ref(), "without value");
+    ASSERT_DEATH((std::ignore = *Either<void, int>::Error()), "without value");
+    ASSERT_DEATH(std::ignore = ok.error_ref(), "without error");
+#endif
+}
+
+namespace {
+enum class ParseError { Negative, TooLarge };
+
+constexpr Either<ParseError, int> checkLimit(int value) {
+    if (value < 0) {
+        return Either<ParseError, int>::Error(ParseError::Negative);
+    }
+    if (value > 100) {
+        return Either<ParseError, int>::Error(ParseError::TooLarge);
+    }
+    return Either<ParseError, int>::Ok(value);
+}
+} // namespace
+
+TEST(EitherTest, validate_constexpr_evaluation) {
+    constexpr auto result = Either<ParseError, int>::Ok(40)
+            .fmap([](int v) { return v + 2; })
+            .bind(checkLimit)
+            .fmap([](int v) { return v * 2; });
+    static_assert(result.isOk());
+    static_assert(result.value() == 84);
+    static_assert(*result == 84);
+    static_assert(result == Either<ParseError, int>::Ok(84));
+
+    constexpr auto failed = Either<ParseError, int>::Ok(200).bind(checkLimit).fmap([](int v) { return v + 1; });
+    static_assert(failed.isError());
+    static_assert(failed.error() == ParseError::TooLarge);
+    static_assert(failed.valueOr(0) == 0);
+
+    static_assert(Either<void, int>::Ok(1).fmap([](int v) { return v + 1; }).value() == 2);
+    static_assert(Either<int, void>::Error(3).error() == 3);
+    static_assert(either::Ok<int>(4).value_ref() == 4);
+    static_assert(Either<void, Color>::Ok(Color::Red).isOk());
+
+    constexpr auto composed = compose(checkLimit, [](int v) { return Either<ParseError, int>::Ok(v + 1); });
+    static_assert(composed(10).value() == 11);
+    static_assert(composed(-1).error() == ParseError::Negative);
+    ASSERT_EQ(result.value(), 84);
+}
+
+TEST(EitherTest, validate_pipeline) {
+    {
+        const auto f1 = [](int i) { return either::Ok<std::string>(i * 2); };
+        const auto f2 = [](int i) { return either::Ok<std::string>(std::to_string(i * 2)); };
+        const auto f = pipeline(f1, f2);
+        ASSERT_EQ(f(2).value(), "8");
+    }
+    {
+        int calls = 0;
+        const auto f1 = [](int i) {
+            return i > 0 ? Either<std::string, int>::Ok(i) : Either<std::string, int>::Error("negative");
+        };
+        const auto f2 = [&calls](int i) { ++calls; return Either<std::string, int>::Ok(i + 1); };
+        const auto f = pipeline(f1, f2, f2);
+        ASSERT_EQ(f(1).value(), 3);
+        ASSERT_EQ(f(-1).error(), "negative");
+        ASSERT_EQ(calls, 2);
+    }
+    {
+        const auto f1 = [](int i) { return i > 0 ? either::Ok<int, void>() : either::Error<int, void>(i); };
+        const auto f2 = []() { return either::Ok<int>(std::string("ok")); };
+        const auto f = pipeline(f1, f2);
+        ASSERT_EQ(f(1).value(), "ok");
+        ASSERT_EQ(f(-2).error(), -2);
+    }
+    {
+        const auto f1 = [](const Either<int, int>& i) { return either::Ok<int>(i.value() * 2); };
+        const auto f2 = [](const Either<int, int>& i) { return either::Ok<int>(std::to_string(i.value() * 2)); };
+        ASSERT_EQ(pipeline(f1, f2)(either::Ok<int>(2)).value(), "8");
+    }
+}
+
+TEST(EitherTest, validate_traverse) {
+    const auto parse = [](const std::string& s) {
+        return s.empty() ? either::Error<std::string, int>("empty") : either::Ok<std::string>(static_cast<int>(s.size()));
+    };
+    const std::vector<std::string> words{"a", "bb", "ccc"};
+    const auto sizes = either::traverse(words, parse);
+    ASSERT_TRUE(sizes.isOk());
+    ASSERT_EQ(sizes.value(), (std::vector<int>{1, 2, 3}));
+
+    int calls = 0;
+    const auto counted = [&calls, &parse](const std::string& s) { ++calls; return parse(s); };
+    const auto failed = either::traverse(std::vector<std::string>{"a", "", "ccc"}, counted);
+    ASSERT_EQ(failed.error(), "empty");
+    ASSERT_EQ(calls, 2);
+
+    const auto noError = either::traverse(words, [](const std::string& s) { return either::Ok<void>(s.size()); });
+    ASSERT_EQ(noError.value().size(), 3U);
+
+    using Pointer = std::unique_ptr<int>;
+    std::vector<Pointer> pointers;
+    pointers.push_back(std::make_unique<int>(1));
+    pointers.push_back(std::make_unique<int>(2));
+    const auto moved = either::traverse(std::move(pointers), [](Pointer p) { return Either<std::string, Pointer>::Ok(std::move(p)); });
+    ASSERT_EQ(*moved.value_ref()[1], 2);
+}
+
+TEST(EitherTest, validate_sequence) {
+    const std::list<Either<std::string, int>> oks{either::Ok<std::string>(1), either::Ok<std::string>(2)};
+    ASSERT_EQ(either::sequence(oks).value(), (std::vector<int>{1, 2}));
+
+    const std::vector<Either<ParseError, int>> withErrors{
+            either::Ok<ParseError>(1), either::Error<ParseError, int>(ParseError::Negative), either::Error<ParseError, int>(ParseError::TooLarge)};
+    ASSERT_EQ(either::sequence(withErrors).error(), ParseError::Negative);
+
+    const std::vector<Either<void, int>> withVoidError{either::Ok<void>(1), either::Error<void, int>()};
+    ASSERT_TRUE(either::sequence(withVoidError).isError());
+
+    std::vector<Either<int, CopyMoveCounter>> counters;
+    counters.push_back(Either<int, CopyMoveCounter>::Ok(std::in_place));
+    counters.push_back(Either<int, CopyMoveCounter>::Ok(std::in_place));
+    CopyMoveCounter::reset();
+    const auto collected = either::sequence(std::move(counters));
+    ASSERT_EQ(collected.value_ref().size(), 2U);
+    ASSERT_EQ(CopyMoveCounter::copies, 0);
+}
@@ -0,0 +1,107 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/EitherVector.h"
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace yafl;
+
+namespace {
+enum class ErrorCode { Missing, Invalid };
+
+using Rows = EitherVector<ErrorCode, int>;
+
+Rows makeColumn(std::size_t size) {
+    Rows column;
+    for (std::size_t i = 0; i < size; ++i) {
+        if (i % 100 == 7) {
+            column.pushError(i % 200 == 7 ? ErrorCode::Missing : ErrorCode::Invalid);
+        } else {
+            column.push_back(static_cast<int>(i));
+        }
+    }
+    return column;
+}
+} // namespace
+
+TEST(EitherVectorTest, validate_domain_type_info) {
+    ASSERT_TRUE(type::DomainTypeInfo<Rows>::hasFunctorBase);
+    ASSERT_FALSE(type::DomainTypeInfo<Rows>::hasMonadicBase);
+    ASSERT_TRUE((std::is_same_v<type::DomainTypeInfo<Rows>::ValueType, int>));
+    ASSERT_TRUE((std::is_same_v<type::DomainTypeInfo<Rows>::ErrorType, ErrorCode>));
+}
+
+TEST(EitherVectorTest, validate_row_access) {
+    const Rows column{either::Ok<ErrorCode>(1), either::Error<ErrorCode, int>(ErrorCode::Missing),
+                      either::Ok<ErrorCode>(3), either::Error<ErrorCode, int>(ErrorCode::Invalid)};
+    ASSERT_EQ(column.size(), 4U);
+    ASSERT_EQ(column.errorCount(), 2U);
+    ASSERT_TRUE(column.isOk(0));
+    ASSERT_FALSE(column.isOk(1));
+    ASSERT_EQ(column[0], either::Ok<ErrorCode>(1));
+    ASSERT_EQ(column[1], (either::Error<ErrorCode, int>(ErrorCode::Missing)));
+    ASSERT_EQ(column[3], (either::Error<ErrorCode, int>(ErrorCode::Invalid)));
+
+    const auto large = makeColumn(1000);
+    ASSERT_EQ(large.errorCount(), 10U);
+    ASSERT_EQ(large[507], (either::Error<ErrorCode, int>(ErrorCode::Invalid)));
+    ASSERT_EQ(large[607], (either::Error<ErrorCode, int>(ErrorCode::Missing)));
+    ASSERT_EQ(large[608], either::Ok<ErrorCode>(608));
+}
+
+TEST(EitherVectorTest, validate_fmap) {
+    const auto column = makeColumn(1000);
+    int calls = 0;
+    const auto halves = column.fmap([&calls](int i) { ++calls; return i / 2.0; });
+    ASSERT_EQ(calls, 990);
+    ASSERT_TRUE((std::is_same_v<std::decay_t<decltype(halves)>, EitherVector<ErrorCode, double>>));
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        ASSERT_EQ(halves[i], column[i].fmap([](int v) { return v / 2.0; }));
+    }
+
+    const auto strings = functor::fmap([](int i) { return std::to_string(i); }, column);
+    ASSERT_EQ(strings[1], (either::Ok<ErrorCode, std::string>("1")));
+    ASSERT_EQ(strings.errorCount(), 10U);
+}
+
+TEST(EitherVectorTest, validate_map_error) {
+    const auto column = makeColumn(1000);
+    int calls = 0;
+    const auto messages = column.mapError([&calls](ErrorCode code) {
+        ++calls;
+        return std::string(code == ErrorCode::Missing ? "missing" : "invalid");
+    });
+    ASSERT_EQ(calls, 10);
+    ASSERT_EQ(messages[7], (either::Error<std::string, int>("missing")));
+    ASSERT_EQ(messages[107], (either::Error<std::string, int>("invalid")));
+    ASSERT_EQ(messages[8], either::Ok<std::string>(8));
+
+    auto owned = EitherVector<std::string, int>{either::Error<std::string, int>("dummy")};
+    const auto moved = std::move(owned).mapError([](std::string&& s) { return std::move(s) + "!"; });
+    ASSERT_EQ(moved[0], (either::Error<std::string, int>("dummy!")));
+}
+
+TEST(EitherVectorTest, validate_partition) {
+    const auto column = makeColumn(1000);
+    const auto [errors, values] = column.partition();
+    ASSERT_EQ(errors.size, 10U);
+    ASSERT_EQ(errors.indexes[0], 7U);
+    ASSERT_EQ(errors.errors[0], ErrorCode::Missing);
+    ASSERT_EQ(errors.indexes[9], 907U);
+    ASSERT_EQ(values.size, 990U);
+    ASSERT_EQ(values.rows, 1000U);
+
+    std::size_t visited = 0;
+    values.forEach([&visited](std::size_t index, int value) {
+        ASSERT_EQ(static_cast<std::size_t>(value), index);
+        ++visited;
+    });
+    ASSERT_EQ(visited, 990U);
+}
@@ -0,0 +1,49 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "AllocationFailure.h"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+/// Allocations the calling thread may still do before operator new throws, negative when not armed
+thread_local long allocationBudget = -1;
+} // namespace
+
+namespace test {
+
+AllocationFailure::AllocationFailure(long budget) {
+    allocationBudget = budget;
+}
+
+AllocationFailure::~AllocationFailure() {
+    allocationBudget = -1;
+}
+
+} // namespace test
+
+void* operator new(std::size_t size) {
+    if (allocationBudget == 0) {
+        throw std::bad_alloc();
+    }
+    if (allocationBudget > 0) {
+        --allocationBudget;
+    }
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
@@ -0,0 +1,24 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+#pragma once
+
+namespace test {
+
+/**
+ * Makes the global operator new of the test, defined in AllocationFailure.cpp, throw std::bad_alloc
+ * on the calling thread once the given number of allocations succeeded. Other threads are not affected.
+ */
+class AllocationFailure {
+public:
+    explicit AllocationFailure(long budget);
+    ~AllocationFailure();
+
+    AllocationFailure(const AllocationFailure&) = delete;
+    AllocationFailure& operator=(const AllocationFailure&) = delete;
+};
+
+} // namespace test
@@ -0,0 +1,163 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Either.h"
+#include "yafl/Future.h"
+#include "yafl/WorkStealingExecutor.h"
+#include "AllocationFailure.h"
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace yafl;
+
+namespace {
+constexpr std::size_t Threads = 4;
+
+/// Spawns a binary tree of tasks of given depth from inside the pool
+void spawnTree(executor::Executor& pool, std::atomic<int>& counter, int depth) {
+    counter.fetch_add(1, std::memory_order_relaxed);
+    if (depth > 0) {
+        pool.execute([&pool, &counter, depth]() { spawnTree(pool, counter, depth - 1); });
+        pool.execute([&pool, &counter, depth]() { spawnTree(pool, counter, depth - 1); });
+    }
+}
+} // namespace
+
+TEST(WorkStealingExecutorTest, validate_deque) {
+    executor::details::WorkStealingDeque<int*> deque(2);
+    std::vector<int> items(10);
+    ASSERT_EQ(deque.pop(), nullptr);
+    ASSERT_EQ(deque.steal(), nullptr);
+    for (auto& item : items) {
+        deque.push(&item);
+    }
+    ASSERT_FALSE(deque.empty());
+    ASSERT_EQ(deque.steal(), &items[0]);
+    ASSERT_EQ(deque.pop(), &items[9]);
+    ASSERT_EQ(deque.steal(), &items[1]);
+    for (std::size_t index = 8; index >= 2; --index) {
+        ASSERT_EQ(deque.pop(), &items[index]);
+    }
+    ASSERT_TRUE(deque.empty());
+    ASSERT_EQ(deque.pop(), nullptr);
+}
+
+TEST(WorkStealingExecutorTest, validate_concurrent_steal) {
+    constexpr int Items = 100000;
+    executor::details::WorkStealingDeque<int*> deque;
+    std::vector<int> items(Items, 1);
+    std::atomic<bool> done{false};
+    std::atomic<int> stolen{0};
+    std::vector<std::thread> thieves;
+    for (std::size_t index = 0; index < Threads; ++index) {
+        thieves.emplace_back([&]() {
+            while (!done.load()) {
+                if (int* item = deque.steal()) {
+                    stolen.fetch_add(*item);
+                }
+            }
+        });
+    }
+    int popped = 0;
+    for (std::size_t index = 0; index < items.size(); ++index) {
+        deque.push(&items[index]);
+        if (index % 3 == 0) {
+            if (int* own = deque.pop()) {
+                popped += *own;
+            }
+        }
+    }
+    while (int* own = deque.pop()) {
+        popped += *own;
+    }
+    done.store(true);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    ASSERT_EQ(popped + stolen.load(), Items);
+}
+
+TEST(WorkStealingExecutorTest, validate_injection_queue) {
+    executor::details::InjectionQueue<int*> queue(4);
+    std::vector<int> items(5);
+    ASSERT_TRUE(queue.empty());
+    for (std::size_t index = 0; index < 4; ++index) {
+        ASSERT_TRUE(queue.push(&items[index]));
+    }
+    ASSERT_FALSE(queue.push(&items[4]));
+    ASSERT_EQ(queue.pop(), &items[0]);
+    ASSERT_TRUE(queue.push(&items[4]));
+    for (std::size_t index = 1; index < 5; ++index) {
+        ASSERT_EQ(queue.pop(), &items[index]);
+    }
+    ASSERT_EQ(queue.pop(), nullptr);
+}
+
+TEST(WorkStealingExecutorTest, validate_runs_all_tasks) {
+    std::atomic<int> counter{0};
+    {
+        executor::WorkStealingExecutor pool(Threads, 64);
+        ASSERT_EQ(pool.size(), Threads);
+        for (int index = 0; index < 10000; ++index) {
+            pool.execute([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        pool.execute([&pool, &counter]() { spawnTree(pool, counter, 10); });
+    }
+    ASSERT_EQ(counter.load(), 10000 + (1 << 11) - 1);
+}
+
+TEST(WorkStealingExecutorTest, validate_idle_workers_wake_up) {
+    executor::WorkStealingExecutor pool(Threads);
+    for (int round = 0; round < 100; ++round) {
+        std::atomic<bool> done{false};
+        if (round % 10 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        pool.execute([&done]() { done.store(true); });
+        while (!done.load()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+TEST(WorkStealingExecutorTest, validate_future_on_pool) {
+    executor::WorkStealingExecutor pool(Threads);
+    auto result = future::async(pool, []() { return Either<std::string, int>::Ok(20); });
+    for (int index = 0; index < 100; ++index) {
+        result = result.bind([&pool](int value) {
+            return future::async(pool, [value]() { return Either<std::string, int>::Ok(value + 1); });
+        });
+    }
+    ASSERT_EQ(result.fmap([](int value) { return value * 2; }).get(), (Either<std::string, int>::Ok(240)));
+}
+
+TEST(WorkStealingExecutorTest, validate_failed_construction_joins_workers) {
+    // fails every allocation of the constructor in turn, including the start of each worker thread
+    for (long budget = 0;; ++budget) {
+        try {
+            std::optional<executor::WorkStealingExecutor> pool;
+            {
+                const test::AllocationFailure failure(budget);
+                pool.emplace(Threads);
+            }
+            std::atomic<int> counter{0};
+            pool->execute([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+            pool.reset();
+            ASSERT_EQ(counter.load(), 1);
+            ASSERT_GT(budget, static_cast<long>(Threads));
+            return;
+        } catch (const std::bad_alloc&) {
+        }
+    }
+}
@@ -0,0 +1,238 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Either.h"
+#include "yafl/Future.h"
+#include "yafl/HOF.h"
+#include "yafl/WorkStealingExecutor.h"
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace yafl;
+
+namespace {
+/// Executor that queues tasks until the test runs them
+class ManualExecutor final : public executor::Executor {
+public:
+    void execute(std::function<void()> task) override {
+        _tasks.push_back(std::move(task));
+    }
+
+    std::size_t pending() const { return _tasks.size(); }
+
+    void runAll() {
+        while (!_tasks.empty()) {
+            auto task = std::move(_tasks.front());
+            _tasks.pop_front();
+            task();
+        }
+    }
+
+private:
+    std::deque<std::function<void()>> _tasks;
+};
+
+/// Executor that runs every task on its own thread
+class ThreadExecutor final : public executor::Executor {
+public:
+    ~ThreadExecutor() override {
+        // tasks may still submit continuations while the first threads are joined
+        for (;;) {
+            std::thread thread;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_threads.empty()) {
+                    return;
+                }
+                thread = std::move(_threads.back());
+                _threads.pop_back();
+            }
+            thread.join();
+        }
+    }
+
+    void execute(std::function<void()> task) override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _threads.emplace_back(std::move(task));
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::thread> _threads;
+};
+} // namespace
+
+TEST(FutureTest, validate_domain_type_info) {
+    ASSERT_TRUE((type::DomainTypeInfo<Future<std::string, int>>::hasFunctorBase));
+    ASSERT_TRUE((type::DomainTypeInfo<Future<std::string, int>>::hasApplicativeBase));
+    ASSERT_TRUE((type::DomainTypeInfo<Future<std::string, int>>::hasMonadicBase));
+    ASSERT_TRUE((type::IsAsync<Future<std::string, int>>::value));
+    ASSERT_FALSE((type::IsAsync<Either<std::string, int>>::value));
+    ASSERT_TRUE((std::is_same_v<type::DomainTypeInfo<Future<std::string, int>>::ErrorType, std::string>));
+    ASSERT_TRUE((std::is_same_v<type::DomainTypeInfo<Future<std::string, int>>::ValueType, int>));
+}
+
+TEST(FutureTest, validate_ready_future_runs_inline) {
+    ManualExecutor executor;
+    const auto future = Future<std::string, int>::Ok(20, executor);
+    ASSERT_TRUE(future.isReady());
+
+    const auto mapped = future.fmap([](int i) { return i + 1; })
+                              .bind([](int i) { return Either<std::string, int>::Ok(i * 2); })
+                              .bind([&executor](int i) { return Future<std::string, std::string>::Ok(std::to_string(i), executor); });
+    ASSERT_TRUE(mapped.isReady());
+    ASSERT_EQ(executor.pending(), 0U);
+    ASSERT_EQ(mapped.get(), (Either<std::string, std::string>::Ok("42")));
+
+    const auto failed = Future<std::string, int>::Error("dummy").fmap([](int i) { return i + 1; });
+    ASSERT_EQ(failed.get(), (Either<std::string, int>::Error("dummy")));
+}
+
+TEST(FutureTest, validate_continuations_are_scheduled) {
+    ManualExecutor executor;
+    Promise<std::string, int> promise(executor);
+    int calls = 0;
+    const auto mapped = promise.future().fmap([&calls](int i) { ++calls; return i + 1; });
+    const auto bound = mapped.bind([&calls](int i) { ++calls; return Either<std::string, int>::Ok(i * 2); });
+    ASSERT_FALSE(bound.isReady());
+
+    promise.setValue(20);
+    ASSERT_EQ(calls, 0);
+    ASSERT_EQ(executor.pending(), 1U);
+    executor.runAll();
+    ASSERT_EQ(calls, 2);
+    ASSERT_TRUE(bound.isReady());
+    ASSERT_EQ(bound.get(), (Either<std::string, int>::Ok(42)));
+
+    Promise<std::string, int> failing(executor);
+    const auto skipped = failing.future().bind([&calls](int i) { ++calls; return Future<std::string, int>::Ok(i); });
+    failing.setError("dummy");
+    executor.runAll();
+    ASSERT_EQ(calls, 2);
+    ASSERT_EQ(skipped.get(), (Either<std::string, int>::Error("dummy")));
+}
+
+TEST(FutureTest, validate_bind_waits_for_inner_future) {
+    ManualExecutor executor;
+    Promise<std::string, int> outer(executor);
+    Promise<std::string, std::string> inner(executor);
+    const auto result = outer.future().bind([&inner](int) { return inner.future(); });
+    outer.setValue(1);
+    executor.runAll();
+    ASSERT_FALSE(result.isReady());
+    inner.setValue("dummy");
+    executor.runAll();
+    ASSERT_EQ(result.get(), (Either<std::string, std::string>::Ok("dummy")));
+}
+
+TEST(FutureTest, validate_apply) {
+    ManualExecutor executor;
+    const auto add = Future<std::string, std::function<int(int, int)>>::Ok([](int a, int b) { return a + b; });
+    Promise<std::string, int> promise(executor);
+    const auto sum = add(promise.future(), 2);
+    ASSERT_FALSE(sum.isReady());
+    promise.setValue(40);
+    executor.runAll();
+    ASSERT_EQ(sum.get(), (Either<std::string, int>::Ok(42)));
+
+    ASSERT_EQ(add(Either<std::string, int>::Error("dummy"), 2).get(), (Either<std::string, int>::Error("dummy")));
+    const auto answer = Future<std::string, std::function<int()>>::Ok([]() { return 42; });
+    ASSERT_EQ(answer().get(), (Either<std::string, int>::Ok(42)));
+}
+
+TEST(FutureTest, validate_async_compose) {
+    ThreadExecutor executor;
+    const auto fetch = [&executor](int id) {
+        return future::async(executor, [id]() { return Either<std::string, int>::Ok(id * 10); });
+    };
+    const auto check = [](int value) {
+        return value > 0 ? Either<std::string, int>::Ok(value) : Either<std::string, int>::Error("negative");
+    };
+    const auto render = [&executor](int value) {
+        return future::async(executor, [value]() { return Either<std::string, std::string>::Ok(std::to_string(value)); });
+    };
+
+    const auto pipeline = compose(compose(fetch, check), render);
+    ASSERT_EQ(pipeline(4).get(), (Either<std::string, std::string>::Ok("40")));
+    ASSERT_EQ(pipeline(-4).get(), (Either<std::string, std::string>::Error("negative")));
+
+    const auto sync_then_async = compose(check, render);
+    ASSERT_EQ(sync_then_async(-1).get(), (Either<std::string, std::string>::Error("negative")));
+}
+
+TEST(FutureTest, validate_exceptions_are_stored) {
+    Promise<std::string, int> promise;
+    int calls = 0;
+    const auto throwing = promise.future().fmap([](int i) -> int { throw std::runtime_error(std::to_string(i)); });
+    const auto sibling = promise.future().fmap([](int i) { return i + 1; });
+    const auto skipped = throwing.bind([&calls](int i) { ++calls; return Either<std::string, int>::Ok(i); });
+    promise.setValue(1);
+    ASSERT_TRUE(sibling.isReady());
+    ASSERT_EQ(sibling.get(), (Either<std::string, int>::Ok(2)));
+    ASSERT_TRUE(skipped.isReady());
+    ASSERT_THROW(std::ignore = throwing.get(), std::runtime_error);
+    ASSERT_THROW(std::ignore = skipped.get(), std::runtime_error);
+    ASSERT_EQ(calls, 0);
+
+    const auto ready = Future<std::string, int>::Ok(1).bind([](int) -> Either<std::string, int> { throw std::runtime_error("bind"); });
+    ASSERT_THROW(std::ignore = ready.get(), std::runtime_error);
+
+    executor::WorkStealingExecutor pool(2);
+    const auto async = future::async(pool, []() -> Either<std::string, int> { throw std::runtime_error("async"); });
+    ASSERT_THROW(std::ignore = async.get(), std::runtime_error);
+}
+
+TEST(FutureTest, validate_result_is_set_once) {
+    Promise<std::string, int> promise;
+    const auto future = promise.future();
+    promise.setValue(1);
+    ASSERT_THROW(promise.setValue(2), std::logic_error);
+    ASSERT_THROW(promise.setException(std::make_exception_ptr(std::runtime_error("dummy"))), std::logic_error);
+    ASSERT_EQ(future.get(), (Either<std::string, int>::Ok(1)));
+}
+
+TEST(FutureTest, validate_abandoned_promise_breaks_future) {
+    std::optional<Future<std::string, int>> future;
+    std::optional<Future<std::string, int>> mapped;
+    {
+        Promise<std::string, int> promise;
+        future = promise.future();
+        mapped = future->fmap([](int i) { return i + 1; });
+        {
+            const auto copy = promise;
+        }
+        ASSERT_FALSE(future->isReady());
+    }
+    ASSERT_TRUE(future->isReady());
+    ASSERT_TRUE(mapped->isReady());
+    try {
+        std::ignore = future->get();
+        FAIL() << "expected a broken promise";
+    } catch (const std::future_error& error) {
+        ASSERT_EQ(error.code(), std::future_errc::broken_promise);
+    }
+    ASSERT_THROW(std::ignore = mapped->get(), std::future_error);
+
+    Promise<std::string, int> promise;
+    const auto settled = promise.future();
+    {
+        auto copy = promise;
+        copy.setValue(1);
+    }
+    ASSERT_EQ(settled.get(), (Either<std::string, int>::Ok(1)));
+}
@@ -6,7 +6,13 @@
  */
 
 #include "yafl/HOF.h"
+#include "yafl/Maybe.h"
+#include "TestHelpers.h"
+#include <functional>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <gtest/gtest.h>
 
 using namespace yafl;
@@ -161,4 +167,181 @@ TEST(HOFTest, validate_partial_application) {
         const auto result = yafl::partial(func2);
         ASSERT_EQ(result, 42);
     }
-}
\ No newline at end of file
+}
+TEST(HOFTest, validate_combinators_return_concrete_closures) {
+    const auto func = [](int i, int j, const std::string& s){ return s + std::to_string(i*j); };
+    {
+        const auto partial1 = yafl::partial(func, 2);
+        using Signature = std::function<std::string(int, std::string)>;
+        ASSERT_FALSE((std::is_same_v<std::decay_t<decltype(partial1)>, Signature>));
+        ASSERT_TRUE((std::is_same_v<function::Info<decltype(partial1)>::Signature, Signature>));
+        ASSERT_EQ(partial1(4, "ola"), "ola8");
+    }
+    {
+        const auto curried = yafl::curry(func);
+        const auto curried1 = curried(2);
+        using Signature = std::function<std::string(int, const std::string&)>;
+        ASSERT_FALSE((std::is_same_v<std::decay_t<decltype(curried1)>, Signature>));
+        ASSERT_EQ(function::Info<decltype(curried1)>::ArgCount, 1);
+        ASSERT_TRUE((std::is_same_v<function::Info<decltype(curried1)>::ArgType<0>, int>));
+        ASSERT_EQ(curried1(4)("ola"), "ola8");
+    }
+    {
+        const auto moveOnlyArg = [](std::string&& s, int i){ return s + std::to_string(i); };
+        const auto partial1 = yafl::partial(moveOnlyArg, std::string("ola"));
+        ASSERT_EQ(partial1(1), "ola1");
+        ASSERT_EQ(partial1(2), "ola2");
+    }
+}
+
+TEST(HOFTest, validate_move_only_arguments) {
+    const auto consume = [](std::unique_ptr<int> p, int i) { return *p + i; };
+    {
+        auto partial1 = yafl::partial(consume, std::make_unique<int>(2));
+        ASSERT_EQ(std::move(partial1)(3), 5);
+    }
+    {
+        ASSERT_EQ(yafl::curry(consume)(std::make_unique<int>(2))(4), 6);
+    }
+    {
+        const auto inspect = [](const std::unique_ptr<int>& p, int i) { return *p + i; };
+        const auto partial1 = yafl::partial(inspect, std::make_unique<int>(2));
+        ASSERT_EQ(partial1(1), 3);
+        ASSERT_EQ(partial1(2), 4);
+    }
+    {
+        auto owner = std::make_unique<int>(3);
+        auto add = [owner = std::move(owner)](int i) { return *owner + i; };
+        auto moved = [add = std::move(add)](int i, int j) { return add(i) + j; };
+        const auto partial1 = yafl::partial(std::move(moved), 1);
+        ASSERT_EQ(partial1(1), 5);
+    }
+    {
+        const auto make = [](int i) { return yafl::Maybe<std::unique_ptr<int>>::Just(std::make_unique<int>(i)); };
+        const auto read = [](std::unique_ptr<int> p) { return yafl::Maybe<int>::Just(*p); };
+        const auto composed = yafl::compose(make, read);
+        ASSERT_EQ(composed(7).value(), 7);
+    }
+}
+
+TEST(HOFTest, validate_rvalue_application_does_not_copy) {
+    const auto count = [](test::CopyMoveCounter, test::CopyMoveCounter, test::CopyMoveCounter) { return 3; };
+    const auto inspect = [](const test::CopyMoveCounter&, const test::CopyMoveCounter&, int i) { return i; };
+    test::CopyMoveCounter counter;
+
+    test::CopyMoveCounter::reset();
+    ASSERT_EQ(yafl::curry(count)(counter)(counter)(counter), 3);
+    ASSERT_EQ(test::CopyMoveCounter::copies, 3);
+
+    test::CopyMoveCounter::reset();
+    ASSERT_EQ(yafl::curry(inspect)(counter)(counter)(4), 4);
+    ASSERT_EQ(test::CopyMoveCounter::copies, 2);
+
+    const auto curried = yafl::curry(count)(counter);
+    test::CopyMoveCounter::reset();
+    ASSERT_EQ(curried(counter)(counter), 3);
+    ASSERT_EQ(test::CopyMoveCounter::copies, 3);
+
+    auto partial1 = yafl::partial(inspect, counter, counter);
+    test::CopyMoveCounter::reset();
+    ASSERT_EQ(partial1(5), 5);
+    ASSERT_EQ(std::move(partial1)(6), 6);
+    ASSERT_EQ(test::CopyMoveCounter::copies, 0);
+}
+
+TEST(HOFTest, validate_partial_of_wide_callables) {
+    struct Token {
+        explicit Token(int v) : value{v} {}
+        int value;
+    };
+    const auto func = [](Token a, int b, Token c, int d, int e, int f, int g, int h, int i, int j) {
+        return a.value + b + c.value + d + e + f + g + h + i + j;
+    };
+    const auto partial3 = yafl::partial(func, Token{1}, 2, Token{3});
+    ASSERT_EQ(partial3(4, 5, 6, 7, 8, 9, 10), 55);
+    ASSERT_EQ(yafl::partial(partial3, 4, 5, 6, 7, 8, 9)(10), 55);
+
+    using Args = std::tuple<Token, int, Token>;
+    static_assert(yafl::tuple::IsTupleSubset<Args, std::tuple<Token, int>>::value);
+    static_assert(!yafl::tuple::IsTupleSubset<Args, std::tuple<Token, Token>>::value);
+    static_assert(!yafl::tuple::IsTupleSubset<Args, std::tuple<Token, int, Token, int>>::value);
+    static_assert(std::is_same_v<yafl::tuple::TupleSubset<1, Args>, std::tuple<int, Token>>);
+    static_assert(std::is_same_v<yafl::tuple::TupleSubset<3, Args>, std::tuple<>>);
+}
+
+namespace {
+struct Account {
+    int balance;
+    int deposit(int amount) const noexcept { return balance + amount; }
+};
+
+int twice(int i) noexcept { return i * 2; }
+
+struct Overloaded {
+    int operator()(int i) const { return i + 1; }
+    std::string operator()(const std::string& s) const { return s + "!"; }
+};
+} // namespace
+
+TEST(HOFTest, validate_callable_introspection) {
+    using PointerInfo = function::Info<decltype(&twice)>;
+    static_assert(std::is_same_v<PointerInfo::ReturnType, int> && PointerInfo::ArgCount == 1);
+
+    using MethodInfo = function::Info<decltype(&Account::deposit)>;
+    static_assert(std::is_same_v<MethodInfo::DeclaredArgTypes, std::tuple<const Account&, int>>);
+    static_assert(std::is_same_v<MethodInfo::ReturnType, int>);
+
+    using MemberInfo = function::Info<decltype(&Account::balance)>;
+    static_assert(std::is_same_v<MemberInfo::DeclaredArgTypes, std::tuple<const Account&>>);
+    static_assert(std::is_same_v<MemberInfo::ReturnType, const int&>);
+
+    const auto mutableLambda = [count = 0](int& i) mutable noexcept { i += ++count; };
+    using LambdaInfo = function::Info<decltype(mutableLambda)>;
+    static_assert(std::is_same_v<LambdaInfo::DeclaredArgTypes, std::tuple<int&>> && std::is_void_v<LambdaInfo::ReturnType>);
+
+    using StdFunctionInfo = function::Info<std::function<double(float, char)>>;
+    static_assert(std::is_same_v<StdFunctionInfo::ArgTypes, std::tuple<float, char>>);
+
+    const auto generic = [](const auto& value) { return value.size(); };
+    using GenericInfo = function::Info<decltype(generic), const std::string&>;
+    static_assert(std::is_same_v<GenericInfo::ReturnType, std::size_t>);
+    static_assert(std::is_same_v<GenericInfo::ArgType<0>, std::string>);
+    static_assert(std::is_same_v<function::Info<Overloaded, int>::ReturnType, int>);
+    static_assert(std::is_same_v<function::Info<Overloaded, std::string>::ReturnType, std::string>);
+    // a callable with a single signature ignores the context
+    static_assert(std::is_same_v<function::Info<decltype(&twice), std::string>::ArgType<0>, int>);
+
+    ASSERT_EQ(yafl::partial(&Account::deposit, Account{10})(5), 15);
+    ASSERT_EQ(yafl::curry(&Account::deposit)(Account{1})(2), 3);
+}
+
+TEST(HOFTest, validate_generic_kleisli_stages) {
+    const auto parse = [](const std::string& s) { return s.empty() ? Maybe<int>::Nothing() : Maybe<int>::Just(std::stoi(s)); };
+    const auto half = [](auto i) { return i % 2 == 0 ? Maybe<decltype(i)>::Just(i / 2) : Maybe<decltype(i)>::Nothing(); };
+    const auto describe = [](const auto& i) { return Maybe<std::string>::Just(std::to_string(i)); };
+
+    const auto composed = yafl::compose(yafl::compose(parse, half), describe);
+    ASSERT_EQ(composed("8").value(), "4");
+    ASSERT_FALSE(composed("7").hasValue());
+    ASSERT_FALSE(composed("").hasValue());
+
+    const auto flat = yafl::pipeline(parse, half, half, describe);
+    ASSERT_EQ(flat("8").value(), "2");
+    ASSERT_FALSE(flat("6").hasValue());
+
+    const auto shout = yafl::pipeline(parse, describe, [](const auto& s) { return Maybe<std::string>::Just(Overloaded{}(s)); });
+    ASSERT_EQ(shout("3").value(), "3!");
+}
+
+TEST(HOFTest, validate_constexpr_combinators) {
+    constexpr auto inc = [](int i) { return i + 1; };
+    constexpr auto twice = [](int i) { return i * 2; };
+    constexpr auto composed = yafl::compose(inc, twice);
+    static_assert(composed(3) == 8);
+    static_assert(yafl::compose(composed, yafl::id<int>)(1) == 4);
+    static_assert(yafl::id(5) == 5);
+    static_assert(yafl::constf(6)(1, 2, 3) == 6);
+    static_assert(yafl::all([](int i) { return i > 0; }, 1, 2, 3));
+    static_assert(!yafl::any([](int i) { return i > 5; }, 1, 2, 3));
+    ASSERT_EQ(composed(3), 8);
+}
@@ -0,0 +1,35 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Instantiations.h"
+#include "test/TypeInstantiations.h"
+#include <string>
+#include <gtest/gtest.h>
+
+using namespace yafl;
+
+TEST(Instantiations, validate_common_types) {
+    const auto number = Maybe<int>::Just(20);
+    EXPECT_TRUE(number.hasValue());
+    EXPECT_EQ(number.fmap([](int value) { return value + 1; }), Maybe<int>::Just(21));
+    EXPECT_FALSE(Maybe<std::string>::Nothing().hasValue());
+    EXPECT_EQ(*Maybe<std::string>::Just("yafl"), "yafl");
+
+    using Result = Either<std::string, int>;
+    const auto parsed = Result::Ok(2).bind([](int value) { return value > 1 ? Result::Error("too big") : Result::Ok(value); });
+    EXPECT_TRUE(parsed.isError());
+    EXPECT_EQ(parsed.error(), "too big");
+    EXPECT_EQ(Result::Ok(2), Result::Ok(2));
+}
+
+TEST(Instantiations, validate_project_types) {
+    using Result = Either<test::Failure, test::UserId>;
+    const auto user = Maybe<test::UserId>::Just(test::UserId{7});
+    EXPECT_EQ(user.value().value, 7);
+    EXPECT_EQ(Result::Ok(test::UserId{7}), Result::Ok(user.value()));
+    EXPECT_EQ(Result::Error(test::Failure{"unknown"}).error().reason, "unknown");
+}
@@ -0,0 +1,25 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+#pragma once
+
+#include <string>
+
+namespace test {
+
+struct UserId {
+    int value;
+
+    bool operator==(const UserId& other) const { return value == other.value; }
+};
+
+struct Failure {
+    std::string reason;
+
+    bool operator==(const Failure& other) const { return reason == other.reason; }
+};
+
+} // namespace test
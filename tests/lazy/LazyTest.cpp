@@ -0,0 +1,144 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Either.h"
+#include "yafl/HOF.h"
+#include "yafl/Lazy.h"
+#include "yafl/Maybe.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace yafl;
+
+TEST(Lazy, validate_domain_type_info) {
+    using LazyType = Lazy<int>;
+    EXPECT_TRUE(type::DomainTypeInfo<LazyType>::hasFunctorBase);
+    EXPECT_TRUE(type::DomainTypeInfo<LazyType>::hasApplicativeBase);
+    EXPECT_TRUE(type::DomainTypeInfo<LazyType>::hasMonadicBase);
+    EXPECT_TRUE(type::IsAsync<LazyType>::value);
+    EXPECT_TRUE((std::is_same_v<type::DomainTypeInfo<LazyType>::ValueType, int>));
+}
+
+TEST(Lazy, validate_memoization) {
+    int evaluations = 0;
+    const auto value = lazy::Defer([&evaluations]() { ++evaluations; return 42; });
+    EXPECT_FALSE(value.isEvaluated());
+    EXPECT_EQ(evaluations, 0);
+
+    const auto copy = value;
+    EXPECT_EQ(value.get(), 42);
+    EXPECT_EQ(copy.get(), 42);
+    EXPECT_TRUE(copy.isEvaluated());
+    EXPECT_EQ(evaluations, 1);
+
+    EXPECT_TRUE(lazy::Ready(std::string("ready")).isEvaluated());
+    EXPECT_EQ(lazy::Ready(std::string("ready")).get(), "ready");
+}
+
+TEST(Lazy, validate_chain_evaluates_nothing_until_forced) {
+    int evaluations = 0;
+    const auto source = lazy::Defer([&evaluations]() { ++evaluations; return 2; });
+    const auto chain = source
+            .fmap([&evaluations](int value) { ++evaluations; return value * 10; })
+            .bind([&evaluations](int value) { ++evaluations; return lazy::Ready(std::to_string(value)); });
+    EXPECT_EQ(evaluations, 0);
+    EXPECT_FALSE(source.isEvaluated());
+
+    EXPECT_EQ(chain.get(), "20");
+    EXPECT_EQ(chain.get(), "20");
+    EXPECT_EQ(evaluations, 3);
+    EXPECT_TRUE(source.isEvaluated());
+}
+
+TEST(Lazy, validate_apply) {
+    const auto add = lazy::Ready(std::function<int(int, int)>([](int a, int b) { return a + b; }));
+    EXPECT_EQ(add(lazy::Ready(1), lazy::Ready(2)).get(), 3);
+    EXPECT_EQ(add(1)(2).get(), 3);
+    EXPECT_EQ(add(lazy::Defer([]() { return 40; }), 2).get(), 42);
+}
+
+TEST(Lazy, validate_kleisli_compose) {
+    const auto parse = [](const std::string& text) { return lazy::Defer([text]() { return std::stoi(text); }); };
+    const auto twice = [](int value) { return lazy::Ready(value * 2); };
+    const auto pipeline = compose(parse, twice);
+    EXPECT_EQ(pipeline("21").get(), 42);
+}
+
+TEST(Lazy, validate_single_evaluation_across_threads) {
+    std::atomic<int> evaluations{0};
+    const auto value = lazy::Defer([&evaluations]() {
+        evaluations.fetch_add(1, std::memory_order_relaxed);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return std::make_shared<int>(7);
+    });
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    std::vector<const int*> seen(8, nullptr);
+    for (std::size_t i = 0; i < seen.size(); ++i) {
+        threads.emplace_back([&value, &start, &seen, i]() {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            seen[i] = value.get().get();
+        });
+    }
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(evaluations.load(), 1);
+    for (const int* pointer : seen) {
+        EXPECT_EQ(pointer, value.get().get());
+    }
+}
+
+TEST(Lazy, validate_exception_retries) {
+    int attempts = 0;
+    const auto flaky = lazy::Defer([&attempts]() {
+        if (++attempts == 1) {
+            throw std::runtime_error("first attempt");
+        }
+        return attempts;
+    });
+    EXPECT_THROW(static_cast<void>(flaky.get()), std::runtime_error);
+    EXPECT_FALSE(flaky.isEvaluated());
+    EXPECT_EQ(flaky.get(), 2);
+    EXPECT_EQ(flaky.get(), 2);
+}
+
+TEST(Lazy, validate_errors_are_memoized) {
+    int parses = 0;
+    int compiles = 0;
+    const auto config = lazy::Defer([&parses]() {
+        ++parses;
+        return Either<std::string, int>::Error("bad config");
+    });
+    const auto compiled = lazy::then(config, [&compiles](int value) {
+        ++compiles;
+        return Either<std::string, int>::Ok(value * 2);
+    });
+    const auto described = lazy::then(compiled, [](int value) { return std::to_string(value); });
+
+    EXPECT_EQ(described.get().error(), "bad config");
+    EXPECT_EQ(described.get().error(), "bad config");
+    EXPECT_EQ(compiled.get().error(), "bad config");
+    EXPECT_EQ(parses, 1);
+    EXPECT_EQ(compiles, 0);
+
+    const auto maybe = lazy::then(lazy::Ready(Maybe<int>::Just(4)), [](int value) { return Maybe<int>::Just(value + 1); });
+    EXPECT_EQ(maybe.get(), Maybe<int>::Just(5));
+}
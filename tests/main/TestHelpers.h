@@ -0,0 +1,38 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+#pragma once
+
+#include <string>
+#include <utility>
+
+namespace test {
+
+/// Counts the copies and moves of all its instances
+struct CopyMoveCounter {
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    CopyMoveCounter() = default;
+    CopyMoveCounter(const CopyMoveCounter&) { ++copies; }
+    CopyMoveCounter(CopyMoveCounter&&) noexcept { ++moves; }
+    CopyMoveCounter& operator=(const CopyMoveCounter&) { ++copies; return *this; }
+    CopyMoveCounter& operator=(CopyMoveCounter&&) noexcept { ++moves; return *this; }
+
+    static void reset() { copies = 0; moves = 0; }
+};
+
+/// Neither copyable nor movable, can only be constructed in place
+struct Pinned {
+    Pinned(int first, std::string second) : a{first}, b{std::move(second)} {}
+    Pinned(const Pinned&) = delete;
+    Pinned(Pinned&&) = delete;
+
+    int a;
+    std::string b;
+};
+
+} // namespace test
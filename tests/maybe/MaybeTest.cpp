@@ -7,8 +7,12 @@
 
 #include "yafl/HOF.h"
 #include "yafl/Maybe.h"
+#include "TestHelpers.h"
+#include <memory>
 #include <string>
 #include <tuple>
+#include <list>
+#include <vector>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -533,3 +537,256 @@ TEST(MaybeTest, validate_lift) {
         ASSERT_FALSE(result4.hasValue());
     }
 }
+
+using test::CopyMoveCounter;
+using test::Pinned;
+
+TEST(MaybeTest, validate_rvalue_chain_moves_value) {
+    {
+        CopyMoveCounter::reset();
+        const auto result = maybe::Just(CopyMoveCounter{})
+                .fmap([](CopyMoveCounter c) { return c; })
+                .bind([](CopyMoveCounter c) { return maybe::Just(std::move(c)); })
+                .fmap([](CopyMoveCounter&& c) { return std::move(c); })
+                .bind([](CopyMoveCounter c) { return Maybe<CopyMoveCounter>::Just(std::move(c)); })
+                .fmap([](CopyMoveCounter c) { return c; });
+        ASSERT_TRUE(result.hasValue());
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+        ASSERT_GT(CopyMoveCounter::moves, 0);
+    }
+    {
+        CopyMoveCounter::reset();
+        const auto result = functor::fmap([](CopyMoveCounter c) { return c; },
+                                          monad::bind([](CopyMoveCounter c) { return maybe::Just(std::move(c)); },
+                                                      maybe::Just(CopyMoveCounter{})));
+        ASSERT_TRUE(result.hasValue());
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+    }
+    {
+        CopyMoveCounter::reset();
+        auto source = maybe::Just(CopyMoveCounter{});
+        CopyMoveCounter::reset();
+        const auto result = source.fmap([](const CopyMoveCounter& c) { return c; });
+        ASSERT_TRUE(result.hasValue());
+        ASSERT_TRUE(source.hasValue());
+        ASSERT_GT(CopyMoveCounter::copies, 0);
+    }
+    {
+        CopyMoveCounter::reset();
+        auto source = maybe::Just(CopyMoveCounter{});
+        std::ignore = std::move(source).value();
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+    }
+}
+
+TEST(MaybeTest, validate_lift_returns_concrete_closure) {
+    const auto lifted = maybe::lift([](int i, const std::string& s) { return s + std::to_string(i);});
+    using Signature = std::function<Maybe<std::string>(const Maybe<int>&, const Maybe<std::string>&)>;
+    ASSERT_FALSE((std::is_same_v<std::decay_t<decltype(lifted)>, Signature>));
+    ASSERT_TRUE((std::is_same_v<function::Info<decltype(lifted)>::Signature, Signature>));
+    ASSERT_EQ(lifted(maybe::Just(1), maybe::Just<std::string>("dummy")).value(), "dummy1");
+}
+
+TEST(MaybeTest, validate_lift_passes_references) {
+    const auto lifted = maybe::lift([](const CopyMoveCounter& a, const CopyMoveCounter& b, int c) { return (&a != &b) ? c : 0; });
+    const auto a = Maybe<CopyMoveCounter>::Just(std::in_place);
+    const auto b = Maybe<CopyMoveCounter>::Just(std::in_place);
+    CopyMoveCounter::reset();
+    ASSERT_EQ(lifted(a, b, maybe::Just(1)).value(), 1);
+    ASSERT_FALSE(lifted(a, Maybe<CopyMoveCounter>::Nothing(), maybe::Just(1)).hasValue());
+    ASSERT_EQ(CopyMoveCounter::copies, 0);
+    ASSERT_EQ(CopyMoveCounter::moves, 0);
+
+    const auto consuming = maybe::lift([](std::string&& s) { return std::move(s) + "!"; });
+    const auto source = maybe::Just<std::string>("dummy");
+    ASSERT_EQ(consuming(source).value(), "dummy!");
+    ASSERT_EQ(source.value(), "dummy");
+}
+
+TEST(MaybeTest, validate_partial_apply_keeps_bound_argument) {
+    const auto func = [](std::string prefix, std::unique_ptr<int> p) { return prefix + std::to_string(*p); };
+    const auto partialApply = maybe::Just(func)(std::string("value"));
+    ASSERT_EQ(partialApply.value()(std::make_unique<int>(1)), "value1");
+    ASSERT_EQ(partialApply.value()(std::make_unique<int>(2)), "value2");
+}
+
+TEST(MaybeTest, validate_in_place_construction) {
+    const auto pinned = Maybe<Pinned>::Just(std::in_place, 1, "dummy");
+    ASSERT_TRUE(pinned.hasValue());
+
+    const auto free_pinned = maybe::Just<Pinned>(std::in_place, 2, "dummy");
+    ASSERT_TRUE(free_pinned.hasValue());
+
+    auto pointer = maybe::Just(std::make_unique<int>(3));
+    ASSERT_TRUE((std::is_same_v<decltype(pointer), Maybe<std::unique_ptr<int>>>));
+    ASSERT_TRUE(pointer.hasValue());
+
+    const int value = 4;
+    ASSERT_TRUE((std::is_same_v<decltype(maybe::Just(value)), Maybe<int>>));
+
+    CopyMoveCounter::reset();
+    auto maybe = Maybe<CopyMoveCounter>::Nothing();
+    maybe.emplace();
+    ASSERT_TRUE(maybe.hasValue());
+    maybe = Maybe<CopyMoveCounter>::Just(std::in_place);
+    ASSERT_EQ(CopyMoveCounter::copies, 0);
+
+    auto number = Maybe<int>::Nothing();
+    ASSERT_EQ(number.emplace(5), 5);
+    ASSERT_EQ(number.value(), 5);
+}
+
+TEST(MaybeTest, validate_move_only_payload) {
+    using Pointer = std::unique_ptr<int>;
+    const auto result = Maybe<Pointer>::Just(std::make_unique<int>(1))
+            .fmap([](Pointer p) { *p += 1; return p; })
+            .bind([](Pointer p) { return maybe::Just(std::move(p)); })
+            .fmap([](const Pointer& p) { return *p; });
+    ASSERT_EQ(result.value(), 2);
+
+    auto source = maybe::Just(std::make_unique<int>(3));
+    ASSERT_EQ(source.fmap([](const Pointer& p) { return *p; }).value(), 3);
+    ASSERT_TRUE(source.hasValue());
+    const Pointer extracted = std::move(source).value();
+    ASSERT_EQ(*extracted, 3);
+
+    ASSERT_EQ(*(maybe::Just(std::make_unique<int>(4)).valueOr(nullptr)), 4);
+    ASSERT_EQ(*(Maybe<Pointer>::Nothing().valueOr(std::make_unique<int>(5))), 5);
+
+    const auto lifted = maybe::lift([](Pointer a, const Pointer& b) { return *a + *b; });
+    ASSERT_EQ(lifted(maybe::Just(std::make_unique<int>(6)), maybe::Just(std::make_unique<int>(7))).value(), 13);
+    ASSERT_FALSE(lifted(maybe::Just(std::make_unique<int>(6)), Maybe<Pointer>::Nothing()).hasValue());
+}
+
+TEST(MaybeTest, validate_unchecked_accessors) {
+    auto maybe = maybe::Just<std::string>("dummy");
+    ASSERT_EQ(*maybe, "dummy");
+    ASSERT_EQ(maybe->size(), 5U);
+    ASSERT_EQ(&maybe.value_ref(), &*maybe);
+    *maybe += "1";
+    ASSERT_EQ(maybe.value(), "dummy1");
+    const std::string moved = *std::move(maybe);
+    ASSERT_EQ(moved, "dummy1");
+
+    const auto pointer = maybe::Just(std::make_unique<int>(2));
+    ASSERT_EQ(**pointer, 2);
+    ASSERT_EQ(*pointer.value_ref(), 2);
+#if YAFL_ASSERTS_ENABLED
+    ASSERT_DEATH(std::ignore = Maybe<int>::Nothing().value_ref(), "without value");
+    ASSERT_DEATH(std::ignore = *Maybe<int>::Nothing(), "without value");
+#endif
+}
+
+namespace {
+constexpr Maybe<int> parsePort(int value) {
+    return (value > 0 && value < 65536) ? maybe::Just(value) : Maybe<int>::Nothing();
+}
+} // namespace
+
+TEST(MaybeTest, validate_constexpr_evaluation) {
+    constexpr auto port = maybe::Just(8000)
+            .fmap([](int v) { return v + 80; })
+            .bind(parsePort)
+            .fmap([](int v) { return v * 2; });
+    static_assert(port.hasValue());
+    static_assert(port.value() == 16160);
+    static_assert(*port == 16160);
+    static_assert(port == maybe::Just(16160));
+
+    constexpr auto invalid = maybe::Just(70000).bind(parsePort).fmap([](int v) { return v + 1; });
+    static_assert(!invalid.hasValue());
+    static_assert(invalid.valueOr(-1) == -1);
+    static_assert(!Maybe<void>::Nothing().hasValue());
+    static_assert(Maybe<void>::Just().fmap([]() { return 1; }).value() == 1);
+
+    constexpr auto composed = compose(parsePort, [](int v) { return maybe::Just(v + 1); });
+    static_assert(composed(80).value() == 81);
+    static_assert(!composed(0).hasValue());
+    ASSERT_EQ(port.value(), 16160);
+}
+
+TEST(MaybeTest, validate_pipeline) {
+    {
+        const auto f1 = [](int i) { return maybe::Just(i * 2); };
+        const auto f2 = [](int i) { return maybe::Just(std::to_string(i * 2)); };
+        const auto f3 = [](const std::string& s) { return maybe::Just(s + "!"); };
+        const auto f = pipeline(f1, f2, f3);
+        ASSERT_EQ(f(2).value(), "8!");
+        ASSERT_EQ(f(2), compose(compose(f1, f2), f3)(2));
+        ASSERT_TRUE((std::is_same_v<function::Info<decltype(f)>::Signature, std::function<Maybe<std::string>(int)>>));
+    }
+    {
+        int calls = 0;
+        const auto f1 = [](int i) { return i > 0 ? maybe::Just(i) : Maybe<int>::Nothing(); };
+        const auto f2 = [&calls](int i) { ++calls; return maybe::Just(i + 1); };
+        const auto f = pipeline(f1, f2, f2, f2);
+        ASSERT_EQ(f(1).value(), 4);
+        ASSERT_EQ(calls, 3);
+        ASSERT_FALSE(f(0).hasValue());
+        ASSERT_EQ(calls, 3);
+    }
+    {
+        const auto f1 = [](int) { return maybe::Just(); };
+        const auto f2 = []() { return maybe::Just(1); };
+        const auto f3 = [](const Maybe<int>& m) { return maybe::Just(m.valueOr(0) + 1); };
+        ASSERT_EQ(pipeline(f1, f2, f3)(0).value(), 2);
+    }
+    {
+        CopyMoveCounter::reset();
+        const auto stage = [](CopyMoveCounter c) { return maybe::Just(std::move(c)); };
+        const auto result = pipeline(stage, stage, stage, stage)(CopyMoveCounter{});
+        ASSERT_TRUE(result.hasValue());
+        ASSERT_EQ(CopyMoveCounter::copies, 0);
+    }
+    {
+        using Pointer = std::unique_ptr<int>;
+        const auto f1 = [](int i) { return maybe::Just(std::make_unique<int>(i)); };
+        const auto f2 = [](Pointer p) { *p += 1; return maybe::Just(std::move(p)); };
+        ASSERT_EQ(*pipeline(f1, f2, f2)(1).value(), 3);
+    }
+    {
+        constexpr auto f = pipeline([](int i) { return maybe::Just(i + 1); },
+                                    [](int i) { return i > 1 ? maybe::Just(i) : Maybe<int>::Nothing(); });
+        static_assert(f(1).value() == 2);
+        static_assert(!f(0).hasValue());
+    }
+}
+
+TEST(MaybeTest, validate_traverse) {
+    const auto parse = [](const std::string& s) { return s.empty() ? Maybe<int>::Nothing() : maybe::Just(static_cast<int>(s.size())); };
+    const std::vector<std::string> words{"a", "bb", "ccc"};
+    const auto sizes = maybe::traverse(words, parse);
+    ASSERT_TRUE(sizes.hasValue());
+    ASSERT_EQ(sizes.value(), (std::vector<int>{1, 2, 3}));
+
+    int calls = 0;
+    const auto counted = [&calls, &parse](const std::string& s) { ++calls; return parse(s); };
+    ASSERT_FALSE(maybe::traverse(std::vector<std::string>{"a", "", "ccc"}, counted).hasValue());
+    ASSERT_EQ(calls, 2);
+
+    ASSERT_EQ(maybe::traverse(std::vector<std::string>{}, parse).value(), std::vector<int>{});
+
+    using Pointer = std::unique_ptr<int>;
+    std::vector<Pointer> pointers;
+    pointers.push_back(std::make_unique<int>(1));
+    pointers.push_back(std::make_unique<int>(2));
+    const auto moved = maybe::traverse(std::move(pointers), [](Pointer p) { return maybe::Just(std::move(p)); });
+    ASSERT_EQ(*moved.value_ref()[1], 2);
+}
+
+TEST(MaybeTest, validate_sequence) {
+    const std::list<Maybe<std::string>> justs{maybe::Just<std::string>("a"), maybe::Just<std::string>("b")};
+    ASSERT_EQ(maybe::sequence(justs).value(), (std::vector<std::string>{"a", "b"}));
+    ASSERT_TRUE(justs.front().hasValue());
+
+    const std::vector<Maybe<int>> withNothing{maybe::Just(1), Maybe<int>::Nothing(), maybe::Just(3)};
+    ASSERT_FALSE(maybe::sequence(withNothing).hasValue());
+
+    std::vector<Maybe<CopyMoveCounter>> counters;
+    counters.push_back(Maybe<CopyMoveCounter>::Just(std::in_place));
+    counters.push_back(Maybe<CopyMoveCounter>::Just(std::in_place));
+    CopyMoveCounter::reset();
+    const auto collected = maybe::sequence(std::move(counters));
+    ASSERT_EQ(collected.value_ref().size(), 2U);
+    ASSERT_EQ(CopyMoveCounter::copies, 0);
+}
@@ -0,0 +1,208 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/MaybeVector.h"
+#include "yafl/MaybeVectorKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace yafl;
+
+namespace {
+MaybeVector<double> makeColumn(std::size_t size) {
+    MaybeVector<double> column;
+    for (std::size_t i = 0; i < size; ++i) {
+        if (i % 3 == 0) {
+            column.push_back(Maybe<double>::Nothing());
+        } else {
+            column.push_back(static_cast<double>(i));
+        }
+    }
+    return column;
+}
+
+/// Float column with a missing value every 5 elements, some negative values and a NaN
+MaybeVector<float> makeFloatColumn(std::size_t size, float scale) {
+    MaybeVector<float> column;
+    for (std::size_t i = 0; i < size; ++i) {
+        if (i % 5 == 0) {
+            column.push_back(Maybe<float>::Nothing());
+        } else if (i == 7) {
+            column.push_back(std::numeric_limits<float>::quiet_NaN());
+        } else {
+            column.push_back(scale * (static_cast<float>(i % 17) - 8.0f));
+        }
+    }
+    return column;
+}
+
+/// Runs the check with every instruction set supported by the CPU
+template <typename Check>
+void forEachIsa(Check&& check) {
+    const auto active = maybe_vector::activeIsa();
+    for (auto isa : {maybe_vector::Isa::Scalar, maybe_vector::Isa::Sse42, maybe_vector::Isa::Avx2}) {
+        if (maybe_vector::selectIsa(isa)) {
+            check();
+        }
+    }
+    maybe_vector::selectIsa(active);
+}
+
+template <typename T, typename Expected>
+void expectColumn(const MaybeVector<T>& column, std::size_t size, Expected&& expected) {
+    ASSERT_EQ(column.size(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        const Maybe<T> value = expected(i);
+        ASSERT_EQ(column.hasValue(i), value.hasValue()) << i;
+        if (value.hasValue() && !std::isnan(value.value())) {
+            ASSERT_EQ(column.values()[i], value.value()) << i;
+        }
+    }
+}
+} // namespace
+
+TEST(MaybeVectorTest, validate_domain_type_info) {
+    ASSERT_TRUE(type::DomainTypeInfo<MaybeVector<int>>::hasFunctorBase);
+    ASSERT_TRUE(type::DomainTypeInfo<MaybeVector<int>>::hasMonadicBase);
+    ASSERT_FALSE(type::DomainTypeInfo<MaybeVector<int>>::hasApplicativeBase);
+    ASSERT_TRUE((std::is_same_v<type::DomainTypeInfo<MaybeVector<int>>::ValueType, int>));
+}
+
+TEST(MaybeVectorTest, validate_element_access) {
+    const MaybeVector<int> column{maybe::Just(1), Maybe<int>::Nothing(), maybe::Just(3)};
+    ASSERT_EQ(column.size(), 3U);
+    ASSERT_EQ(column.count(), 2U);
+    ASSERT_TRUE(column.hasValue(0));
+    ASSERT_FALSE(column.hasValue(1));
+    ASSERT_EQ(column[0], maybe::Just(1));
+    ASSERT_EQ(column[1], Maybe<int>::Nothing());
+    ASSERT_EQ(column.values()[2], 3);
+    ASSERT_EQ(column.validity()[0], 0b101U);
+
+    const MaybeVector<int> empty(130);
+    ASSERT_EQ(empty.size(), 130U);
+    ASSERT_EQ(empty.count(), 0U);
+
+    const MaybeVector<int> dense(std::vector<int>(130, 7));
+    ASSERT_EQ(dense.count(), 130U);
+    ASSERT_EQ(dense[129], maybe::Just(7));
+
+    const MaybeVector<int> raw(std::vector<int>{1, 2, 3}, std::vector<bitmap::Word>{0b110U});
+    ASSERT_EQ(raw, (MaybeVector<int>{Maybe<int>::Nothing(), maybe::Just(2), maybe::Just(3)}));
+}
+
+TEST(MaybeVectorTest, validate_fmap) {
+    const auto column = makeColumn(200);
+    int calls = 0;
+    const auto doubled = column.fmap([&calls](double d) { ++calls; return d * 2; });
+    ASSERT_EQ(calls, static_cast<int>(column.count()));
+    ASSERT_EQ(doubled.size(), column.size());
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        ASSERT_EQ(doubled[i], column[i].fmap([](double d) { return d * 2; }));
+    }
+
+    const auto strings = functor::fmap([](double d) { return std::to_string(static_cast<int>(d)); }, column);
+    ASSERT_TRUE((std::is_same_v<std::decay_t<decltype(strings)>, MaybeVector<std::string>>));
+    ASSERT_EQ(strings[1], maybe::Just<std::string>("1"));
+    ASSERT_FALSE(strings.hasValue(3));
+
+    auto owned = MaybeVector<std::string>{maybe::Just<std::string>("dummy")};
+    const auto moved = std::move(owned).fmap([](std::string&& s) { return std::move(s) + "!"; });
+    ASSERT_EQ(moved[0], maybe::Just<std::string>("dummy!"));
+}
+
+TEST(MaybeVectorTest, validate_bind) {
+    const auto column = makeColumn(200);
+    const auto even = column.bind([](double d) {
+        return static_cast<int>(d) % 2 == 0 ? maybe::Just(static_cast<int>(d)) : Maybe<int>::Nothing();
+    });
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        ASSERT_EQ(even.hasValue(i), i % 3 != 0 && i % 2 == 0);
+    }
+    ASSERT_EQ(monad::bind([](double) { return Maybe<int>::Nothing(); }, column).count(), 0U);
+}
+
+TEST(MaybeVectorTest, validate_lift) {
+    const auto add = maybe_vector::lift([](double a, int b) { return a + b; });
+    const MaybeVector<double> lhs{maybe::Just(1.0), maybe::Just(2.0), Maybe<double>::Nothing()};
+    const MaybeVector<int> rhs{maybe::Just(10), Maybe<int>::Nothing(), maybe::Just(30)};
+    const auto sum = add(lhs, rhs);
+    ASSERT_EQ(sum, (MaybeVector<double>{maybe::Just(11.0), Maybe<double>::Nothing(), Maybe<double>::Nothing()}));
+
+    const auto large = makeColumn(1000);
+    const auto product = maybe_vector::lift([](double a, double b, double c) { return a * b * c; })(large, large, large);
+    ASSERT_EQ(product.count(), large.count());
+    ASSERT_EQ(product[500], maybe::Just(500.0 * 500.0 * 500.0));
+}
+
+TEST(MaybeVectorTest, validate_kernels) {
+    constexpr std::size_t size = 131;
+    const auto lhs = makeFloatColumn(size, 1.5f);
+    const auto rhs = makeFloatColumn(size, -0.25f);
+    const auto lift = [&](auto&& callable) {
+        return [&, callable](std::size_t i) { return maybe::lift(callable)(lhs[i], rhs[i]); };
+    };
+
+    forEachIsa([&] {
+        expectColumn(maybe_vector::add(lhs, rhs), size, lift([](float a, float b) { return a + b; }));
+        expectColumn(maybe_vector::sub(lhs, rhs), size, lift([](float a, float b) { return a - b; }));
+        expectColumn(maybe_vector::mul(lhs, rhs), size, lift([](float a, float b) { return a * b; }));
+        expectColumn(maybe_vector::div(lhs, rhs), size, lift([](float a, float b) { return a / b; }));
+        expectColumn(maybe_vector::min(lhs, rhs), size, lift([](float a, float b) { return std::min(a, b); }));
+        expectColumn(maybe_vector::max(lhs, rhs), size, lift([](float a, float b) { return std::max(a, b); }));
+        expectColumn(maybe_vector::fma(lhs, rhs, lhs), size, [&](std::size_t i) {
+            return maybe::lift([](float a, float b, float c) { return std::fma(a, b, c); })(lhs[i], rhs[i], lhs[i]);
+        });
+        expectColumn(maybe_vector::compare(lhs, rhs, maybe_vector::Comparison::Less), size, [&](std::size_t i) {
+            return maybe::lift([](float a, float b) { return static_cast<std::uint8_t>(a < b); })(lhs[i], rhs[i]);
+        });
+        expectColumn(maybe_vector::compare(lhs, rhs, maybe_vector::Comparison::NotEqual), size, [&](std::size_t i) {
+            return maybe::lift([](float a, float b) { return static_cast<std::uint8_t>(a != b); })(lhs[i], rhs[i]);
+        });
+    });
+}
+
+TEST(MaybeVectorTest, validate_kernels_double) {
+    const auto column = makeColumn(101);
+    const auto ones = MaybeVector<double>(std::vector<double>(101, 1.0));
+    forEachIsa([&] {
+        expectColumn(maybe_vector::sub(column, ones), 101, [&](std::size_t i) {
+            return column[i].fmap([](double d) { return d - 1.0; });
+        });
+        expectColumn(maybe_vector::max(column, ones), 101, [&](std::size_t i) {
+            return column[i].fmap([](double d) { return std::max(d, 1.0); });
+        });
+        expectColumn(maybe_vector::compare(column, ones, maybe_vector::Comparison::GreaterEqual), 101, [&](std::size_t i) {
+            return column[i].fmap([](double d) { return static_cast<std::uint8_t>(d >= 1.0); });
+        });
+        expectColumn(maybe_vector::fma(column, column, ones), 101, [&](std::size_t i) {
+            return column[i].fmap([](double d) { return std::fma(d, d, 1.0); });
+        });
+    });
+}
+
+TEST(MaybeVectorTest, validate_kernels_long_double) {
+    const auto column = MaybeVector<long double>(std::vector<long double>{1.5L, 2.0L, -3.0L});
+    const auto ones = MaybeVector<long double>(std::vector<long double>(3, 1.0L));
+    forEachIsa([&] {
+        expectColumn(maybe_vector::add(column, ones), 3, [&](std::size_t i) {
+            return column[i].fmap([](long double d) { return d + 1.0L; });
+        });
+        expectColumn(maybe_vector::fma(column, column, ones), 3, [&](std::size_t i) {
+            return column[i].fmap([](long double d) { return std::fma(d, d, 1.0L); });
+        });
+        expectColumn(maybe_vector::compare(column, ones, maybe_vector::Comparison::Greater), 3, [&](std::size_t i) {
+            return column[i].fmap([](long double d) { return static_cast<std::uint8_t>(d > 1.0L); });
+        });
+    });
+}
@@ -0,0 +1,188 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Maybe.h"
+#include "yafl/Either.h"
+#include "yafl/Parallel.h"
+#include "yafl/WorkStealingExecutor.h"
+#include <functional>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace yafl;
+
+namespace {
+constexpr std::size_t Threads = 4;
+constexpr std::size_t ChunkSize = 16;
+
+/// Executor that forwards a given number of tasks to another executor and rejects the rest
+class RejectingExecutor final : public executor::Executor {
+public:
+    RejectingExecutor(executor::Executor& target, std::size_t accepted) : _target{target}, _accepted{accepted} {}
+
+    void execute(std::function<void()> task) override {
+        if (_accepted == 0) {
+            throw std::bad_alloc();
+        }
+        --_accepted;
+        _target.execute(std::move(task));
+    }
+
+private:
+    executor::Executor& _target;
+    std::size_t _accepted;
+};
+
+std::vector<int> makeRange(std::size_t size) {
+    std::vector<int> range(size);
+    std::iota(range.begin(), range.end(), 0);
+    return range;
+}
+
+/// Minimal user monad, only known to yafl through its DomainDetailsImpl specialization
+template<typename T>
+struct Validated {
+    std::optional<T> value;
+
+    bool operator!() const { return !value.has_value(); }
+    T operator*() && { return std::move(*value); }
+};
+} // namespace
+
+template<typename T>
+struct yafl::type::details::DomainDetailsImpl<Validated<T>> {
+    static constexpr bool hasFunctorBase = false;
+    static constexpr bool hasApplicativeBase = false;
+    static constexpr bool hasMonadicBase = true;
+    using ValueType = T;
+    static constexpr auto handleError = [](auto&& ...) { return Validated<T>{}; };
+    static constexpr auto wrapValue = [](auto&& value) { return Validated<T>{std::forward<decltype(value)>(value)}; };
+    template<typename U>
+    using RebindType = Validated<U>;
+};
+
+TEST(ParallelTest, validate_traverse_matches_sequential) {
+    const auto range = makeRange(10000);
+    const auto square = [](int i) { return maybe::Just(i * i); };
+    const auto parallel = parallel::traverse(range, square, Threads, ChunkSize);
+    const auto sequential = maybe::traverse(range, square);
+    ASSERT_TRUE(parallel.hasValue());
+    ASSERT_EQ(parallel.value(), sequential.value());
+
+    const auto uneven = parallel::traverse(makeRange(1001), square, Threads, ChunkSize);
+    ASSERT_EQ(uneven.value_ref().size(), 1001U);
+    ASSERT_EQ(uneven.value_ref()[1000], 1000000);
+
+    ASSERT_TRUE(parallel::traverse(std::vector<int>{}, square, Threads, ChunkSize).value_ref().empty());
+    ASSERT_EQ(parallel::traverse(makeRange(3), square).value(), (std::vector<int>{0, 1, 4}));
+}
+
+TEST(ParallelTest, validate_traverse_reports_lowest_error) {
+    const auto range = makeRange(10000);
+    const auto check = [](int i) {
+        return (i == 700 || i == 3000 || i == 9000) ? either::Error<std::string, int>("failed at " + std::to_string(i))
+                                                    : either::Ok<std::string>(i);
+    };
+    for (int run = 0; run < 20; ++run) {
+        const auto result = parallel::traverse(range, check, Threads, ChunkSize);
+        ASSERT_TRUE(result.isError());
+        ASSERT_EQ(result.error(), "failed at 700");
+    }
+
+    const auto nothing = parallel::traverse(range, [](int i) { return i == 9999 ? Maybe<int>::Nothing() : maybe::Just(i); }, Threads, ChunkSize);
+    ASSERT_FALSE(nothing.hasValue());
+
+    const auto voidError = parallel::traverse(range, [](int i) { return i == 5000 ? either::Error<void, int>() : either::Ok<void>(i); }, Threads, ChunkSize);
+    ASSERT_TRUE(voidError.isError());
+}
+
+TEST(ParallelTest, validate_traverse_rethrows_lowest_exception) {
+    const auto range = makeRange(10000);
+    const auto throwing = [](int i) {
+        if (i == 8000) {
+            throw std::runtime_error("thrown");
+        }
+        return i == 200 ? either::Error<std::string, int>("failed") : either::Ok<std::string>(i);
+    };
+    ASSERT_EQ(parallel::traverse(range, throwing, Threads, ChunkSize).error(), "failed");
+
+    const auto throwingFirst = [](int i) {
+        if (i == 200) {
+            throw std::runtime_error("thrown");
+        }
+        return i == 8000 ? either::Error<std::string, int>("failed") : either::Ok<std::string>(i);
+    };
+    ASSERT_THROW(parallel::traverse(range, throwingFirst, Threads, ChunkSize), std::runtime_error);
+}
+
+TEST(ParallelTest, validate_traverse_rethrows_failed_store) {
+    /// Throws when moved into the traversed values if poisoned
+    struct Poisoned {
+        explicit Poisoned(int v) : value{v} {}
+        Poisoned(Poisoned&& other) : value{other.value} {
+            if (value == 300) {
+                throw std::runtime_error("moved");
+            }
+        }
+        int value;
+    };
+    const auto range = makeRange(1000);
+    const auto build = [](int i) { return Maybe<Poisoned>::Just(std::in_place, i); };
+    ASSERT_THROW(parallel::traverse(range, build, Threads, ChunkSize), std::runtime_error);
+}
+
+TEST(ParallelTest, validate_traverse_moves_from_rvalue_range) {
+    using Pointer = std::unique_ptr<int>;
+    std::vector<Pointer> pointers;
+    for (int i = 0; i < 1000; ++i) {
+        pointers.push_back(std::make_unique<int>(i));
+    }
+    const auto moved = parallel::traverse(std::move(pointers), [](Pointer p) { return maybe::Just(std::move(p)); }, Threads, ChunkSize);
+    ASSERT_EQ(moved.value_ref().size(), 1000U);
+    ASSERT_EQ(*moved.value_ref()[999], 999);
+}
+
+TEST(ParallelTest, validate_traverse_user_monad) {
+    const auto range = makeRange(1000);
+    auto valid = parallel::traverse(range, [](int i) { return Validated<int>{i}; }, Threads, ChunkSize);
+    ASSERT_TRUE(!!valid);
+    ASSERT_EQ((*std::move(valid)).size(), 1000U);
+
+    const auto invalid = parallel::traverse(range, [](int i) { return i == 500 ? Validated<int>{} : Validated<int>{i}; }, Threads, ChunkSize);
+    ASSERT_FALSE(!!invalid);
+}
+
+TEST(ParallelTest, validate_traverse_on_executor) {
+    executor::WorkStealingExecutor pool(Threads);
+    const auto range = makeRange(1000);
+    const auto doubled = parallel::traverse(pool, range, [](int i) { return maybe::Just(i * 2); }, Threads, ChunkSize);
+    ASSERT_TRUE(doubled.hasValue());
+    ASSERT_EQ(doubled.value().size(), range.size());
+    ASSERT_EQ(doubled.value()[999], 1998);
+
+    const auto failed = parallel::traverse(pool, range, [](int i) {
+        return i % 300 == 299 ? Either<std::string, int>::Error(std::to_string(i)) : Either<std::string, int>::Ok(i);
+    }, Threads, ChunkSize);
+    ASSERT_EQ(failed, (Either<std::string, std::vector<int>>::Error("299")));
+}
+
+TEST(ParallelTest, validate_traverse_on_rejecting_executor) {
+    executor::WorkStealingExecutor pool(Threads);
+    RejectingExecutor executor(pool, 1);
+    const auto range = makeRange(1000);
+    const auto doubled = parallel::traverse(executor, range, [](int i) { return maybe::Just(i * 2); }, Threads, ChunkSize);
+    ASSERT_TRUE(doubled.hasValue());
+    ASSERT_EQ(doubled.value().size(), range.size());
+    ASSERT_EQ(doubled.value()[999], 1998);
+}
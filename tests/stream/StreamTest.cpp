@@ -0,0 +1,112 @@
+/**
+ * \brief       Yet Another Functional Library
+ *
+ * \copyright   2023, Ernesto Festas.
+ *              Distributed under MIT license (See accompanying LICENSE file)
+ */
+
+#include "yafl/Either.h"
+#include "yafl/HOF.h"
+#include "yafl/Maybe.h"
+#include "yafl/Stream.h"
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace yafl;
+using ::testing::ElementsAre;
+
+TEST(Stream, validate_domain_type_info) {
+    using StreamType = decltype(stream::from(std::declval<const std::vector<int>&>()));
+    EXPECT_TRUE(type::DomainTypeInfo<StreamType>::hasFunctorBase);
+    EXPECT_TRUE(type::DomainTypeInfo<StreamType>::hasApplicativeBase);
+    EXPECT_TRUE(type::DomainTypeInfo<StreamType>::hasMonadicBase);
+    EXPECT_TRUE((std::is_same_v<type::DomainTypeInfo<StreamType>::ValueType, int>));
+}
+
+TEST(Stream, validate_fused_pipeline) {
+    const std::vector<int> values{1, 2, 3, 4, 5, 6};
+    int calls = 0;
+    const auto pipeline = stream::from(values)
+            .fmap([&calls](int value) { ++calls; return value * 10; })
+            .filter([](int value) { return value % 20 == 0; })
+            .fmap([](int value) { return std::to_string(value); });
+    EXPECT_EQ(calls, 0);
+
+    EXPECT_EQ(pipeline.fold(std::string(), [](std::string acc, const std::string& value) { return acc + value + ";"; }), "20;40;60;");
+    EXPECT_EQ(calls, 6);
+    EXPECT_THAT(pipeline.toVector(), ElementsAre("20", "40", "60"));
+}
+
+TEST(Stream, validate_take_bounds_infinite_streams) {
+    int pulled = 0;
+    const auto naturals = stream::iterate(0, [&pulled](int value) { ++pulled; return value + 1; });
+    EXPECT_THAT(naturals.filter([](int value) { return value % 3 == 0; }).take(4).toVector(), ElementsAre(0, 3, 6, 9));
+    EXPECT_EQ(pulled, 9);
+    EXPECT_THAT(stream::range(2, 6).toVector(), ElementsAre(2, 3, 4, 5));
+    EXPECT_TRUE(stream::range(6, 2).toVector().empty());
+    EXPECT_THAT(stream::range(0.0, 2.5).toVector(), ElementsAre(0.0, 1.0, 2.0));
+    EXPECT_THAT(stream::range(0.0, 2.0).toVector(), ElementsAre(0.0, 1.0));
+    EXPECT_THAT(stream::range(-2, 1).toVector(), ElementsAre(-2, -1, 0));
+
+    // the successor of the last element is never computed, so this does not overflow
+    const auto powers = stream::iterate(1, [](int value) { return value * 2; }).take(31).toVector();
+    EXPECT_EQ(powers.size(), 31U);
+    EXPECT_EQ(powers.back(), 1 << 30);
+}
+
+TEST(Stream, validate_bind) {
+    const auto repeated = stream::range(1, 4).bind([](int value) {
+        return stream::iterate(value, [](int same) { return same; }).take(static_cast<std::size_t>(value));
+    });
+    EXPECT_THAT(repeated.toVector(), ElementsAre(1, 2, 2, 3, 3, 3));
+    EXPECT_THAT(repeated.take(2).toVector(), ElementsAre(1, 2));
+
+    const auto empty = stream::range(0, 3).bind([](int value) { return stream::range(0, value).filter([](int) { return false; }); });
+    EXPECT_TRUE(empty.toVector().empty());
+}
+
+TEST(Stream, validate_zip) {
+    const std::vector<std::string> names{"a", "b", "c"};
+    const auto odd = stream::iterate(1, [](int value) { return value + 1; }).filter([](int value) { return value % 2 == 1; });
+    EXPECT_THAT(stream::from(names).zip(odd).toVector(),
+                ElementsAre(std::make_pair(std::string("a"), 1), std::make_pair(std::string("b"), 3), std::make_pair(std::string("c"), 5)));
+    EXPECT_EQ(odd.zip(stream::from(names)).fold(0, [](int acc, const auto& pair) { return acc + pair.first; }), 9);
+}
+
+TEST(Stream, validate_apply) {
+    const std::vector<std::function<int(int, int)>> operations{std::plus<>(), std::multiplies<>()};
+    const auto results = stream::from(operations)(stream::range(1, 3), 10);
+    EXPECT_THAT(results.toVector(), ElementsAre(11, 12, 10, 20));
+}
+
+TEST(Stream, validate_try_fold_stops_at_first_error) {
+    using Result = Either<std::string, int>;
+    const std::vector<std::string> inputs{"1", "2", "x", "4"};
+    int parsed = 0;
+    const auto parse = [&parsed](const std::string& text) {
+        ++parsed;
+        return text == "x" ? Result::Error("invalid " + text) : Result::Ok(std::stoi(text));
+    };
+    const auto sum = [](int acc, int value) { return acc + value; };
+
+    const auto failed = stream::from(inputs).fmap(parse).tryFold(0, sum);
+    EXPECT_EQ(failed.error(), "invalid x");
+    EXPECT_EQ(parsed, 3);
+
+    EXPECT_EQ(stream::from(inputs).take(2).fmap(parse).tryFold(0, sum), Result::Ok(3));
+
+    const std::vector<Maybe<int>> maybes{Maybe<int>::Just(1), Maybe<int>::Nothing(), Maybe<int>::Just(3)};
+    EXPECT_FALSE(stream::from(maybes).tryFold(0, sum).hasValue());
+    EXPECT_EQ(stream::from(maybes).filter([](const Maybe<int>& value) { return value.hasValue(); }).tryFold(0, sum), Maybe<int>::Just(4));
+}
+
+TEST(Stream, validate_kleisli_compose) {
+    const auto digits = [](int value) { return stream::range(0, value); };
+    const auto square = [](int value) { return stream::iterate(value * value, [](int same) { return same; }).take(1); };
+    const auto pipeline = compose(digits, square);
+    EXPECT_THAT(pipeline(4).toVector(), ElementsAre(0, 1, 4, 9));
+}